@@ -0,0 +1,79 @@
+# Pre-build step: gzip the web UI in web/ into include/web_assets.h so the
+# firmware serves it pre-compressed with a content-hash ETag.
+#
+# Wired in platformio.ini as `extra_scripts = pre:embed_web.py`. Can also be
+# run by hand from the project root: `python embed_web.py`.
+#
+# The header records the SHA-256 of each source file; it is only rewritten when
+# a source changes, so normal builds do not touch it. gzip output is made
+# deterministic (mtime 0) so the same page always yields the same ETag.
+
+import gzip, hashlib, io, os, re
+
+try:
+    Import("env")
+    PROJECT_DIR = env.subst("$PROJECT_DIR")
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.abspath(__file__))
+
+OUTPUT = os.path.join(PROJECT_DIR, "include", "web_assets.h")
+
+# (source under web/, C symbol prefix, MIME type)
+ASSETS = [
+    ("index.html", "INDEX_HTML", "text/html"),
+]
+
+
+def recorded_hashes(path):
+    try:
+        src = io.open(path, "r", encoding="utf-8").read()
+    except FileNotFoundError:
+        return {}
+    return dict(re.findall(r"// source (\S+) sha256 ([0-9a-f]{64})", src))
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    sources = {}
+    for name, _, _ in ASSETS:
+        sources[name] = open(os.path.join(PROJECT_DIR, "web", name), "rb").read()
+    hashes = {name: hashlib.sha256(data).hexdigest() for name, data in sources.items()}
+    if recorded_hashes(OUTPUT) == hashes:
+        return
+
+    out = [
+        "// Generated by embed_web.py from web/ - do not edit by hand.",
+        "",
+        "#ifndef WEB_ASSETS_H",
+        "#define WEB_ASSETS_H",
+        "",
+    ]
+    for name, sym, mime in ASSETS:
+        raw = sources[name]
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = hashlib.sha256(gz).hexdigest()[:16]
+        out += [
+            "// source %s sha256 %s" % (name, hashes[name]),
+            "// %d B raw -> %d B gzip" % (len(raw), len(gz)),
+            "const char %s_TYPE[] = \"%s\";" % (sym, mime),
+            "const char %s_ETAG[] = \"\\\"%s\\\"\";" % (sym, etag),
+            "const size_t %s_GZ_LEN = %d;" % (sym, len(gz)),
+            "const uint8_t %s_GZ[] PROGMEM = {" % sym,
+            c_array(gz),
+            "};",
+            "",
+        ]
+        print("[web] %-12s %6d B -> %6d B gzip (etag %s)" % (name, len(raw), len(gz), etag))
+    out += ["#endif // WEB_ASSETS_H", ""]
+
+    with io.open(OUTPUT, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out))
+
+
+main()
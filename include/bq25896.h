@@ -0,0 +1,126 @@
+// ============================================================================
+// BQ25896 - Charger driver with a RAM register mirror
+//
+// All of REG00-REG14 live in bq.regs. Reads of charger state come from the
+// mirror; bq_poll_status() refreshes the status/fault registers with one
+// burst read. Configuration changes only touch the mirror and mark registers
+// dirty, and bq_flush() writes the dirty span back in a single burst (the
+// chip auto-increments the register address on multi-byte reads and writes).
+// ============================================================================
+
+#ifndef BQ25896_H
+#define BQ25896_H
+
+#include <stdint.h>
+
+static const uint8_t BQ25896_ADDR = 0x6B;
+static const uint8_t BQ_REG_COUNT = 0x15;        // REG00-REG14
+static const uint8_t BQ_REG_STATUS = 0x0B;       // REG0B system status
+static const uint8_t BQ_REG_FAULT = 0x0C;        // REG0C fault (latched, clears on read)
+
+// Bits the chip clears by itself once the action starts (REG02 CONV_START and
+// FORCE_DPDM, REG03 WD_RST, REG09 FORCE_ICO, REG14 REG_RST). Cleared in the
+// mirror after a flush so a later burst does not re-trigger them.
+const uint8_t BQ_SELF_CLEARING[BQ_REG_COUNT] = {
+  0, 0, 0x82, 0x40, 0, 0, 0, 0, 0, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x80,
+};
+
+struct Bq25896 {
+  uint8_t regs[BQ_REG_COUNT] = {0};
+  uint32_t dirty = 0;      // Bit n = REGn changed in the mirror, not yet written
+  bool present = false;
+  // Bus accounting for /api/status
+  uint32_t txn = 0, bytes = 0;
+  uint32_t txn_per_sec = 0, bytes_per_sec = 0;
+  uint32_t window_txn = 0, window_bytes = 0, window_start = 0;
+};
+Bq25896 bq;
+
+#ifdef CHARGER_SIM
+#include "charger_sim.h"  // bq_bus_read/bq_bus_write against a simulated chip
+#else
+#include <Wire.h>
+
+bool bq_bus_read(uint8_t first, uint8_t* buf, uint8_t count) {
+  Wire.beginTransmission(BQ25896_ADDR);
+  Wire.write(first);
+  if (Wire.endTransmission(false) != 0) return false;
+  if (Wire.requestFrom((int)BQ25896_ADDR, (int)count) != count) return false;
+  for (uint8_t i = 0; i < count; i++) buf[i] = Wire.read();
+  return true;
+}
+
+bool bq_bus_write(uint8_t first, const uint8_t* buf, uint8_t count) {
+  Wire.beginTransmission(BQ25896_ADDR);
+  Wire.write(first);
+  Wire.write(buf, count);
+  return Wire.endTransmission() == 0;
+}
+#endif
+
+bool bq_read_burst(uint8_t first, uint8_t count) {
+  bq.txn += 2;
+  bq.bytes += 2 + 1 + count;  // Addr+reg, addr, data
+  return bq_bus_read(first, &bq.regs[first], count);
+}
+
+bool bq_write_burst(uint8_t first, uint8_t count) {
+  bq.txn++;
+  bq.bytes += 2 + count;
+  return bq_bus_write(first, &bq.regs[first], count);
+}
+
+// Load the whole register file. Returns false if the chip does not answer.
+bool bq_begin() {
+  bq.present = bq_read_burst(0x00, BQ_REG_COUNT);
+  bq.dirty = 0;
+  return bq.present;
+}
+
+// One burst for status + fault - the only registers that change on their own
+// that the firmware cares about. Reading REG0C also clears its latched faults.
+bool bq_poll_status() {
+  if (!bq.present) return false;
+  return bq_read_burst(BQ_REG_STATUS, 2);
+}
+
+uint8_t bq_reg(uint8_t reg) {
+  return bq.regs[reg];
+}
+
+// Change bits in the mirror only - nothing goes on the bus until bq_flush()
+void bq_update_bits(uint8_t reg, uint8_t mask, uint8_t value) {
+  uint8_t v = (uint8_t)((bq.regs[reg] & ~mask) | (value & mask));
+  if (v == bq.regs[reg]) return;
+  bq.regs[reg] = v;
+  bq.dirty |= 1UL << reg;
+}
+
+// Write every dirty register in one burst. Clean registers inside the span
+// are rewritten with their mirrored value; REG0B/0C are read-only and the chip
+// ignores writes to them.
+bool bq_flush() {
+  if (!bq.present || !bq.dirty) return true;
+  uint8_t first = __builtin_ctz(bq.dirty);
+  uint8_t last = 31 - __builtin_clz(bq.dirty);
+  bool ok = bq_write_burst(first, last - first + 1);
+  if (ok) {
+    for (uint8_t r = first; r <= last; r++) bq.regs[r] &= ~BQ_SELF_CLEARING[r];
+    bq.dirty = 0;
+  }
+  return ok;
+}
+
+// Fold bus counters into per-second rates
+void bq_roll_stats() {
+  uint32_t now = millis();
+  uint32_t elapsed = now - bq.window_start;
+  if (elapsed < 1000) return;
+  bq.txn_per_sec = (bq.txn - bq.window_txn) * 1000 / elapsed;
+  bq.bytes_per_sec = (bq.bytes - bq.window_bytes) * 1000 / elapsed;
+  bq.window_txn = bq.txn;
+  bq.window_bytes = bq.bytes;
+  bq.window_start = now;
+}
+
+#endif // BQ25896_H
@@ -0,0 +1,83 @@
+// ============================================================================
+// BRIGHTNESS FADE - Perceptual, time-based fades between panel levels
+//
+// AMOLED luminance is roughly linear in the panel value, but the eye is not,
+// so a linear 200 -> 40 ramp seems to crawl at the top and jump at the
+// bottom. Fades are interpolated in perceptual space (256 steps) and mapped
+// to panel values through a gamma 2.2 LUT. Progress comes from millis(), so
+// a late or dropped tick shortens the next step instead of stretching the
+// fade. Duration and easing are configured per transition type.
+//
+// Include this file in main.cpp after ClockConfig.
+// ============================================================================
+
+#ifndef BRIGHTNESS_FADE_H
+#define BRIGHTNESS_FADE_H
+
+#include <math.h>
+
+enum FadeType : uint8_t { FADE_TOUCH, FADE_CONFIG, FADE_AUTO };   // Index into config.fade_ms/fade_ease
+enum FadeEasing : uint8_t { EASE_LINEAR, EASE_IN_OUT, EASE_OUT, EASE_COUNT };
+
+const float BRIGHTNESS_GAMMA = 2.2f;
+const uint32_t FADE_FRAME_MS = 20;  // Timer period while a fade runs
+
+uint8_t gamma_lut[256];  // Perceptual step -> panel value
+
+struct Fade {
+  float from = 0, to = 0;    // Perceptual steps (0-255)
+  uint32_t start = 0;
+  uint32_t duration = 0;
+  uint8_t easing = EASE_LINEAR;
+  uint8_t target = 0;        // Panel value the fade ends on
+};
+Fade fade;
+uint8_t fade_next_type = FADE_AUTO;  // Set by touch / config before waking the timer
+
+void fade_init() {
+  for (int i = 0; i < 256; i++) {
+    gamma_lut[i] = (uint8_t)lroundf(255.0f * powf(i / 255.0f, BRIGHTNESS_GAMMA));
+  }
+}
+
+// Smallest perceptual step that reaches a panel value (LUT is monotonic)
+uint8_t fade_perceptual(uint8_t level) {
+  int lo = 0, hi = 255;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (gamma_lut[mid] < level) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+float fade_ease(uint8_t easing, float u) {
+  switch (easing) {
+    case EASE_IN_OUT: return u * u * (3 - 2 * u);
+    case EASE_OUT: return 1 - (1 - u) * (1 - u);
+    default: return u;
+  }
+}
+
+bool fade_active(uint32_t now) {
+  return now - fade.start < fade.duration;
+}
+
+// Panel value at `now`
+uint8_t fade_level(uint32_t now) {
+  if (!fade_active(now)) return fade.target;
+  float u = fade_ease(fade.easing, (float)(now - fade.start) / fade.duration);
+  return gamma_lut[(int)lroundf(fade.from + (fade.to - fade.from) * u)];
+}
+
+// Start a fade from wherever the panel is now (mid-fade retargets are smooth)
+void fade_start(uint8_t from_level, uint8_t target, FadeType type, uint32_t now) {
+  fade.from = fade_perceptual(from_level);
+  fade.to = fade_perceptual(target);
+  fade.target = target;
+  fade.start = now;
+  fade.duration = from_level == target ? 0 : config.fade_ms[type];
+  fade.easing = config.fade_ease[type] < EASE_COUNT ? config.fade_ease[type] : EASE_LINEAR;
+}
+
+#endif // BRIGHTNESS_FADE_H
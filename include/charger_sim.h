@@ -0,0 +1,87 @@
+// ============================================================================
+// CHARGER SIM - Simulated BQ25896 for exercising the charger event path
+//
+// Build with -DCHARGER_SIM to replace the I2C bus with an in-RAM register
+// file. charger_sim_set() puts the simulated chip into a state the way the
+// real one changes its status and latches faults. On a host that is all
+// there is, and test/test_charger drives charger_state.h through it. On the
+// board, a FreeRTOS timer also walks a scripted plug/charge/fault sequence
+// and raises a synthetic INT for every step, so the interrupt -> worker ->
+// event -> float voltage chain can be watched on the serial monitor without
+// a battery or USB cable swaps.
+// ============================================================================
+
+#ifndef CHARGER_SIM_H
+#define CHARGER_SIM_H
+
+uint8_t sim_regs[0x15] = {0};
+
+bool bq_bus_read(uint8_t first, uint8_t* buf, uint8_t count) {
+  for (uint8_t i = 0; i < count; i++) {
+    uint8_t reg = first + i;
+    buf[i] = sim_regs[reg];
+    if (reg == 0x0C) sim_regs[reg] = 0;  // Fault register clears on read
+  }
+  return true;
+}
+
+bool bq_bus_write(uint8_t first, const uint8_t* buf, uint8_t count) {
+  for (uint8_t i = 0; i < count; i++) {
+    uint8_t reg = first + i;
+    bool read_only = (reg >= 0x0B && reg != 0x0D && reg != 0x14);
+    if (!read_only) sim_regs[reg] = buf[i];
+  }
+  return true;
+}
+
+// New REG0B status; faults accumulate in REG0C until it is read
+void charger_sim_set(uint8_t status, uint8_t fault) {
+  sim_regs[0x0B] = status;
+  sim_regs[0x0C] |= fault;
+}
+
+#ifdef ARDUINO
+
+#ifndef CHARGER_SIM_STEP_MS
+#define CHARGER_SIM_STEP_MS 10000
+#endif
+
+extern TaskHandle_t charger_task_handle;
+
+struct ChargerSimStep {
+  uint8_t status;  // REG0B: VBUS_STAT[7:5] CHRG_STAT[4:3] PG_STAT[2]
+  uint8_t fault;   // REG0C, latched until read
+  const char* name;
+};
+
+const ChargerSimStep CHARGER_SIM_SCRIPT[] = {
+  {0x00, 0x00, "unplugged"},
+  {0x2C, 0x00, "USB in, pre-charge"},
+  {0x34, 0x00, "fast charge"},
+  {0x3C, 0x00, "charge done"},
+  {0x3C, 0x08, "battery over-voltage fault"},
+  {0x3C, 0x00, "fault cleared"},
+  {0x00, 0x00, "unplugged"},
+};
+const int CHARGER_SIM_STEPS = sizeof(CHARGER_SIM_SCRIPT) / sizeof(CHARGER_SIM_SCRIPT[0]);
+
+int sim_step = 0;
+
+void charger_sim_tick(TimerHandle_t) {
+  sim_step = (sim_step + 1) % CHARGER_SIM_STEPS;
+  const ChargerSimStep& step = CHARGER_SIM_SCRIPT[sim_step];
+  charger_sim_set(step.status, step.fault);
+  Serial.printf("🧪 Charger sim: %s\n", step.name);
+  if (charger_task_handle) xTaskNotifyGive(charger_task_handle);  // Synthetic INT
+}
+
+void charger_sim_begin() {
+  TimerHandle_t t = xTimerCreate("chg_sim", pdMS_TO_TICKS(CHARGER_SIM_STEP_MS), pdTRUE,
+                                 nullptr, charger_sim_tick);
+  xTimerStart(t, 0);
+  Serial.println("🧪 Charger sim running - no I2C traffic to the real BQ25896");
+}
+
+#endif // ARDUINO
+
+#endif // CHARGER_SIM_H
@@ -0,0 +1,94 @@
+// ============================================================================
+// CHARGER STATE - Charge state machine on top of the BQ25896 register mirror
+//
+// Turns REG0B/0C refreshes into VBUS, charge-state and fault events, and
+// runs the float-voltage policy: charge to 4.2V, drop VREG to 4.0V once the
+// charge terminates, and go back to 4.2V when the battery sags below 3.9V.
+// Logging and the UI hand-off stay with the caller, so apart from the bus
+// hooks of bq25896.h this builds anywhere - with -DCHARGER_SIM it runs on a
+// host against the simulated register file (test/test_charger).
+//
+// Include this file in main.cpp after bq25896.h.
+// ============================================================================
+
+#ifndef CHARGER_STATE_H
+#define CHARGER_STATE_H
+
+// Battery float voltage management
+// REG06[7:2] = VREG: 3.840V + (val × 16mV)
+const uint8_t VREG_4208MV = 0x17;  // 4.208V = 3.840 + (23 × 0.016)
+const uint8_t VREG_4000MV = 0x0A;  // 4.000V = 3.840 + (10 × 0.016)
+const float FLOAT_RESTORE_V = 3.9f;
+
+// What charger_refresh() and manage_float_voltage() report back
+enum ChargerEvent : uint8_t {
+  CHG_EVT_VBUS      = 1 << 0,   // VBUS plugged in or removed
+  CHG_EVT_STATE     = 1 << 1,   // CHRG_STAT moved
+  CHG_EVT_FAULT     = 1 << 2,   // A fault was latched in REG0C
+  CHG_EVT_FLOAT_ON  = 1 << 3,   // Charge done - VREG dropped to 4.0V
+  CHG_EVT_FLOAT_OFF = 1 << 4,   // Battery sagged - VREG back to 4.2V
+};
+
+bool float_mode_active = false;
+volatile uint8_t charger_last_fault = 0;   // Last non-zero REG0C seen
+
+// CHRG_STAT in REG0B[4:3]: 00=Not charging, 01=Pre-charge, 10=Fast charging, 11=Charge done
+// Reads the register mirror - bq_poll_status() refreshes it
+uint8_t get_charge_state() {
+  return (bq_reg(BQ_REG_STATUS) >> 3) & 0x03;
+}
+
+bool is_charging() {
+  uint8_t state = get_charge_state();
+  return (state == 1 || state == 2);  // Pre-charge or fast charging
+}
+
+// VBUS_STAT in REG0B[7:5]: 000 = no input
+bool vbus_present() {
+  return (bq_reg(BQ_REG_STATUS) >> 5) != 0;
+}
+
+bool is_charge_done() {
+  return get_charge_state() == 3;  // Charge termination done
+}
+
+void set_charge_voltage(uint8_t vreg) {
+  bq_update_bits(0x06, 0xFC, (vreg << 2));
+  bq_flush();
+}
+
+// Refresh REG0B/0C (one burst) and report what moved since the last refresh.
+// Reading REG0C also clears the faults latched in the chip.
+uint8_t charger_refresh() {
+  uint8_t old_status = bq_reg(BQ_REG_STATUS);
+  if (!bq_poll_status()) return 0;
+  uint8_t status = bq_reg(BQ_REG_STATUS);
+  uint8_t fault = bq_reg(BQ_REG_FAULT);
+  uint8_t events = 0;
+  if ((status ^ old_status) & 0xE0) events |= CHG_EVT_VBUS;
+  if ((status ^ old_status) & 0x18) events |= CHG_EVT_STATE;
+  if (fault) {
+    charger_last_fault = fault;
+    events |= CHG_EVT_FAULT;
+  }
+  return events;
+}
+
+// Float voltage management - charge to 4.2V, then drop to 4.0V for longevity
+uint8_t manage_float_voltage(float battery_v) {
+  if (!float_mode_active && is_charge_done()) {
+    // Just finished charging - drop to float voltage
+    set_charge_voltage(VREG_4000MV);
+    float_mode_active = true;
+    return CHG_EVT_FLOAT_ON;
+  }
+  if (float_mode_active && battery_v < FLOAT_RESTORE_V) {
+    // Battery has discharged below threshold - restore full charge voltage
+    set_charge_voltage(VREG_4208MV);
+    float_mode_active = false;
+    return CHG_EVT_FLOAT_OFF;
+  }
+  return 0;
+}
+
+#endif // CHARGER_STATE_H
@@ -0,0 +1,52 @@
+// ============================================================================
+// CLOCK CONFIG - Every user setting, as edited by the web UI
+//
+// Stored in NVS through config_store.h. Kept in its own header so the codec
+// builds on a host for the native tests (test/test_config_store).
+// ============================================================================
+
+#ifndef CLOCK_CONFIG_H
+#define CLOCK_CONFIG_H
+
+#include <stdint.h>
+
+const uint8_t COLOR_SCHEME_COUNT = 5;  // Rows of COLORS[] in main.cpp
+const uint8_t CLOCK_FACE_COUNT = 2;    // ClockFace in main.cpp
+const int8_t SEGMENT_SKEW_MAX = 20;   // Web UI slider range is 0..SEGMENT_SKEW_MAX px
+
+struct ClockConfig {
+  // Display
+  bool show_seconds = true;
+  bool show_date = true;
+  uint8_t color_scheme = 0; // 0=Red,1=Green,2=Blue,3=White,4=Amber
+  uint8_t clock_face = 0;   // 0=DS-Digital font, 1=Vector 7-segment
+  int8_t segment_skew = 6;  // 7-segment lean in px (vector face only)
+  
+  // Brightness
+  bool auto_brightness = true;
+  uint8_t day_brightness = 200;
+  uint8_t night_brightness = 40;
+  uint8_t transition_minutes = 30;
+  uint16_t fade_ms[3] = {400, 800, 2000};  // Fade length: touch, config change, sunrise/sunset
+  uint8_t fade_ease[3] = {2, 1, 0};        // 0=linear, 1=ease-in-out, 2=ease-out
+  
+  // Night sleep (panel off, deep sleep)
+  uint8_t sleep_mode = 0;          // 0=off, 1=fixed window, 2=sunset to sunrise
+  uint16_t sleep_start = 23 * 60;  // Fixed window, local minutes after midnight
+  uint16_t sleep_end = 6 * 60;
+  
+  // Location (default: San Francisco, CA - update for your location)
+  float latitude = 37.7749;
+  float longitude = -122.4194;
+  char timezone[64] = "PST8PDT,M3.2.0/2,M11.1.0/2";
+  
+  // WiFi
+  char wifi_ssid[32] = "YOUR_WIFI_SSID";
+  char wifi_pass[64] = "YOUR_WIFI_PASSWORD";
+  
+  // Weather (optional)
+  bool weather_enabled = false;
+  char weather_api_key[64] = "";
+};
+
+#endif // CLOCK_CONFIG_H
@@ -0,0 +1,100 @@
+// ============================================================================
+// CLOCK SERVICE - Cached wall-clock time shared by every task
+//
+// getLocalTime() runs newlib localtime_r and the TZ rules on every call. The
+// display, brightness, web and sun code all only need second resolution, so
+// the conversion is done once per second boundary and everyone else gets the
+// cached struct tm. Second/minute/day rollovers are published as sequence
+// counters so consumers stop re-deriving them from tm fields.
+// ============================================================================
+
+#ifndef CLOCK_SERVICE_H
+#define CLOCK_SERVICE_H
+
+#include <time.h>
+
+struct ClockSnapshot {
+  struct tm tm;
+  time_t epoch;
+  uint32_t mono_ms;   // millis() when the snapshot was taken
+  bool valid;         // false until SNTP has set the clock
+};
+
+enum ClockEvent : uint8_t { CLOCK_SECOND, CLOCK_MINUTE, CLOCK_DAY, CLOCK_EVENT_COUNT };
+
+struct ClockService {
+  portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+  struct tm tm = {};
+  time_t epoch = 0;
+  bool valid = false;
+  volatile uint32_t seq[CLOCK_EVENT_COUNT] = {0};
+  // Conversion accounting for /api/status
+  uint32_t calls = 0;
+  uint32_t window_calls = 0;
+  uint32_t conversions = 0;
+  uint32_t saved_per_sec = 0;
+};
+ClockService clock_svc;
+
+// Current local time. Only the first caller after a second boundary pays
+// for localtime_r; everyone else copies the cached result.
+void clock_now(ClockSnapshot* out) {
+  time_t now = time(nullptr);
+
+  portENTER_CRITICAL(&clock_svc.lock);
+  clock_svc.calls++;
+  bool stale = now != clock_svc.epoch;
+  portEXIT_CRITICAL(&clock_svc.lock);
+
+  if (stale) {
+    struct tm fresh;
+    localtime_r(&now, &fresh);
+    bool valid = fresh.tm_year > (2016 - 1900);  // Same test getLocalTime() uses
+
+    portENTER_CRITICAL(&clock_svc.lock);
+    if (now != clock_svc.epoch) {
+      const struct tm& old = clock_svc.tm;
+      if (valid) {
+        clock_svc.seq[CLOCK_SECOND]++;
+        if (!clock_svc.valid || fresh.tm_min != old.tm_min || fresh.tm_hour != old.tm_hour) {
+          clock_svc.seq[CLOCK_MINUTE]++;
+        }
+        if (!clock_svc.valid || fresh.tm_yday != old.tm_yday || fresh.tm_year != old.tm_year) {
+          clock_svc.seq[CLOCK_DAY]++;
+        }
+      }
+      clock_svc.tm = fresh;
+      clock_svc.epoch = now;
+      clock_svc.valid = valid;
+      clock_svc.conversions++;
+      // One conversion per second, so everything since the last one was saved
+      clock_svc.saved_per_sec = clock_svc.calls - clock_svc.window_calls - 1;
+      clock_svc.window_calls = clock_svc.calls;
+    }
+    portEXIT_CRITICAL(&clock_svc.lock);
+  }
+
+  portENTER_CRITICAL(&clock_svc.lock);
+  out->tm = clock_svc.tm;
+  out->epoch = clock_svc.epoch;
+  out->valid = clock_svc.valid;
+  portEXIT_CRITICAL(&clock_svc.lock);
+  out->mono_ms = millis();
+}
+
+// True once per rollover of `event` since the caller last saw it
+bool clock_changed(ClockEvent event, uint32_t& seen) {
+  uint32_t seq = clock_svc.seq[event];
+  if (seq == seen) return false;
+  seen = seq;
+  return true;
+}
+
+// Force the next clock_now() to convert again (e.g. after a TZ change)
+void clock_invalidate() {
+  portENTER_CRITICAL(&clock_svc.lock);
+  clock_svc.epoch = 0;
+  portEXIT_CRITICAL(&clock_svc.lock);
+}
+
+#endif // CLOCK_SERVICE_H
@@ -0,0 +1,131 @@
+// ============================================================================
+// CONFIG BUS - Apply config changes live, per field group
+//
+// A config POST diffs the new ClockConfig against the old one and publishes
+// the changed field groups. Each subsystem subscribes to the groups it owns
+// and names the task its apply callback must run on; the bus only ORs bits
+// into that task's pending mask, and the task runs the callbacks from its own
+// loop via config_dispatch(). So LVGL restyling stays on the render task and
+// WiFi/TZ/sun work stays on the net task, exactly as if they had polled.
+//
+// The web server only validates a POST and submits the result; the net task
+// is the one writer of `config` after boot. It swaps the new config in under
+// config_mux, saves it and publishes the diff. Tasks read single fields
+// directly (aligned scalars cannot tear); anything that needs a consistent
+// copy of the strings off the net task takes config_snapshot().
+//
+// Include this file in main.cpp after ClockConfig and msg_queue.h.
+// ============================================================================
+
+#ifndef CONFIG_BUS_H
+#define CONFIG_BUS_H
+
+#include <atomic>
+
+enum ConfigGroup : uint32_t {
+  CFG_SECONDS    = 1 << 0,   // show_seconds
+  CFG_DATE       = 1 << 1,   // show_date
+  CFG_COLOR      = 1 << 2,   // color_scheme
+  CFG_FACE       = 1 << 3,   // clock_face, segment_skew
+  CFG_BRIGHTNESS = 1 << 4,   // auto_brightness, day/night levels, transition, fades
+  CFG_LOCATION   = 1 << 5,   // latitude, longitude
+  CFG_TIMEZONE   = 1 << 6,   // timezone
+  CFG_WIFI       = 1 << 7,   // wifi_ssid, wifi_pass
+  CFG_WEATHER    = 1 << 8,   // weather_enabled, weather_api_key
+  CFG_SLEEP      = 1 << 9,   // sleep_mode, sleep_start, sleep_end
+};
+
+enum ConfigOwner : uint8_t { CFG_OWNER_RENDER, CFG_OWNER_NET, CFG_OWNER_COUNT };
+
+typedef void (*ConfigApplyFn)(uint32_t changed);
+
+struct ConfigSubscriber {
+  uint32_t groups;
+  uint8_t owner;
+  ConfigApplyFn apply;
+  const char* name;
+};
+
+const int CONFIG_MAX_SUBSCRIBERS = 8;
+
+struct ConfigBus {
+  ConfigSubscriber subs[CONFIG_MAX_SUBSCRIBERS];
+  int count = 0;
+  std::atomic<uint32_t> pending[CFG_OWNER_COUNT];
+  uint32_t publishes = 0;
+  uint32_t last_apply_us = 0;   // Publish to last callback done, for /api/status
+  uint32_t published_at_us = 0;
+};
+ConfigBus config_bus;
+
+SpscQueue<ClockConfig, 2> config_inbox;   // Web server (AsyncTCP task) -> net task
+portMUX_TYPE config_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// Consistent copy of the live config
+void config_snapshot(ClockConfig& out) {
+  portENTER_CRITICAL(&config_mux);
+  out = config;
+  portEXIT_CRITICAL(&config_mux);
+}
+
+// Web server side: hand a validated config to the net task. False if two
+// are already waiting.
+bool config_submit(const ClockConfig& next) {
+  return config_inbox.push(next);
+}
+
+// Register during setup(), before the tasks start
+void config_subscribe(ConfigOwner owner, uint32_t groups, ConfigApplyFn apply, const char* name) {
+  if (config_bus.count >= CONFIG_MAX_SUBSCRIBERS) return;
+  config_bus.subs[config_bus.count++] = {groups, owner, apply, name};
+}
+
+// Which field groups differ between two configs
+uint32_t config_diff(const ClockConfig& a, const ClockConfig& b) {
+  uint32_t changed = 0;
+  if (a.show_seconds != b.show_seconds) changed |= CFG_SECONDS;
+  if (a.show_date != b.show_date) changed |= CFG_DATE;
+  if (a.color_scheme != b.color_scheme) changed |= CFG_COLOR;
+  if (a.clock_face != b.clock_face || a.segment_skew != b.segment_skew) changed |= CFG_FACE;
+  if (a.auto_brightness != b.auto_brightness || a.day_brightness != b.day_brightness ||
+      a.night_brightness != b.night_brightness || a.transition_minutes != b.transition_minutes ||
+      memcmp(a.fade_ms, b.fade_ms, sizeof(a.fade_ms)) || memcmp(a.fade_ease, b.fade_ease, sizeof(a.fade_ease))) {
+    changed |= CFG_BRIGHTNESS;
+  }
+  if (a.latitude != b.latitude || a.longitude != b.longitude) changed |= CFG_LOCATION;
+  if (strcmp(a.timezone, b.timezone)) changed |= CFG_TIMEZONE;
+  if (strcmp(a.wifi_ssid, b.wifi_ssid) || strcmp(a.wifi_pass, b.wifi_pass)) changed |= CFG_WIFI;
+  if (a.weather_enabled != b.weather_enabled || strcmp(a.weather_api_key, b.weather_api_key)) {
+    changed |= CFG_WEATHER;
+  }
+  if (a.sleep_mode != b.sleep_mode || a.sleep_start != b.sleep_start || a.sleep_end != b.sleep_end) {
+    changed |= CFG_SLEEP;
+  }
+  return changed;
+}
+
+// Queue `changed` for every owner with a subscriber interested in it
+void config_publish(uint32_t changed) {
+  if (!changed) return;
+  config_bus.published_at_us = micros();
+  config_bus.publishes++;
+  for (int i = 0; i < config_bus.count; i++) {
+    const ConfigSubscriber& sub = config_bus.subs[i];
+    if (sub.groups & changed) config_bus.pending[sub.owner].fetch_or(changed & sub.groups);
+  }
+}
+
+// Run this owner's callbacks for everything published since the last call
+void config_dispatch(ConfigOwner owner) {
+  uint32_t changed = config_bus.pending[owner].exchange(0);
+  if (!changed) return;
+  for (int i = 0; i < config_bus.count; i++) {
+    const ConfigSubscriber& sub = config_bus.subs[i];
+    if (sub.owner != owner || !(sub.groups & changed)) continue;
+    sub.apply(changed & sub.groups);
+    Serial.printf("⚙️  Applied config to %s\n", sub.name);
+  }
+  config_bus.last_apply_us = micros() - config_bus.published_at_us;
+}
+
+#endif // CONFIG_BUS_H
@@ -0,0 +1,213 @@
+// ============================================================================
+// CONFIG STORE - ClockConfig as one versioned, CRC-protected NVS blob
+//
+// The whole config lives under a single "cfg" key: a small header (magic,
+// schema version, payload size, CRC-32) followed by a packed, fixed-width
+// payload. Boot is one getBytes(); a save encodes the blob and skips the
+// flash write entirely when it matches what is already stored.
+//
+// The payload structs are frozen per version. To change the schema, add a
+// ConfigPayloadV<n+1>, bump CONFIG_SCHEMA_VERSION and teach config_decode()
+// to upgrade the older payloads, filling new fields with their defaults.
+// Configs from before the blob (one NVS key per field) are migrated once by
+// load_config() and the old keys removed. The codec itself has no Arduino
+// dependencies and is covered by the native tests (test/test_config_store).
+// ============================================================================
+
+#ifndef CONFIG_STORE_H
+#define CONFIG_STORE_H
+
+#include <stdint.h>
+#include <string.h>
+#include "clock_config.h"
+
+const uint16_t CONFIG_MAGIC = 0xC10C;
+const uint8_t CONFIG_SCHEMA_VERSION = 3;
+
+struct __attribute__((packed)) ConfigBlobHeader {
+  uint16_t magic;
+  uint8_t version;
+  uint8_t reserved;
+  uint16_t size;     // Payload bytes following the header
+  uint32_t crc;      // CRC-32 of the payload
+};
+
+// Schema version 1 - never edit, add a new version instead
+struct __attribute__((packed)) ConfigPayloadV1 {
+  uint8_t show_seconds;
+  uint8_t show_date;
+  uint8_t color_scheme;
+  uint8_t clock_face;
+  int8_t segment_skew;
+  uint8_t auto_brightness;
+  uint8_t day_brightness;
+  uint8_t night_brightness;
+  uint8_t transition_minutes;
+  float latitude;
+  float longitude;
+  char timezone[64];
+  char wifi_ssid[32];
+  char wifi_pass[64];
+  uint8_t weather_enabled;
+  char weather_api_key[64];
+};
+
+// Schema version 2 - V1 plus per-type brightness fades
+struct __attribute__((packed)) ConfigPayloadV2 {
+  ConfigPayloadV1 v1;
+  uint16_t fade_ms[3];
+  uint8_t fade_ease[3];
+};
+
+// Schema version 3 - V2 plus the night sleep window
+struct __attribute__((packed)) ConfigPayloadV3 {
+  ConfigPayloadV2 v2;
+  uint8_t sleep_mode;
+  uint16_t sleep_start;
+  uint16_t sleep_end;
+};
+
+struct __attribute__((packed)) ConfigBlob {
+  ConfigBlobHeader header;
+  ConfigPayloadV3 payload;
+};
+
+enum ConfigDecodeResult : uint8_t { CFG_DECODE_OK, CFG_DECODE_MIGRATED, CFG_DECODE_BAD };
+
+// Plain bitwise CRC-32 (IEEE) - runs at boot and on save only
+uint32_t config_crc32(const uint8_t* data, size_t len) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (int b = 0; b < 8; b++) crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+  }
+  return ~crc;
+}
+
+// Bounded copy - a payload string may fill its field with no terminator
+void config_copy_str(char* dst, size_t dst_size, const char* src, size_t src_size) {
+  size_t n = strnlen(src, src_size);
+  if (n >= dst_size) n = dst_size - 1;
+  memcpy(dst, src, n);
+  dst[n] = '\0';
+}
+
+void config_to_v1(const ClockConfig& c, ConfigPayloadV1& p) {
+  p.show_seconds = c.show_seconds;
+  p.show_date = c.show_date;
+  p.color_scheme = c.color_scheme;
+  p.clock_face = c.clock_face;
+  p.segment_skew = c.segment_skew;
+  p.auto_brightness = c.auto_brightness;
+  p.day_brightness = c.day_brightness;
+  p.night_brightness = c.night_brightness;
+  p.transition_minutes = c.transition_minutes;
+  p.latitude = c.latitude;
+  p.longitude = c.longitude;
+  config_copy_str(p.timezone, sizeof(p.timezone), c.timezone, sizeof(c.timezone));
+  config_copy_str(p.wifi_ssid, sizeof(p.wifi_ssid), c.wifi_ssid, sizeof(c.wifi_ssid));
+  config_copy_str(p.wifi_pass, sizeof(p.wifi_pass), c.wifi_pass, sizeof(c.wifi_pass));
+  p.weather_enabled = c.weather_enabled;
+  config_copy_str(p.weather_api_key, sizeof(p.weather_api_key), c.weather_api_key, sizeof(c.weather_api_key));
+}
+
+void config_encode(const ClockConfig& c, ConfigBlob& blob) {
+  memset(&blob, 0, sizeof(blob));  // Padding and string tails are deterministic
+  ConfigPayloadV3& p = blob.payload;
+  config_to_v1(c, p.v2.v1);
+  memcpy(p.v2.fade_ms, c.fade_ms, sizeof(p.v2.fade_ms));
+  memcpy(p.v2.fade_ease, c.fade_ease, sizeof(p.v2.fade_ease));
+  p.sleep_mode = c.sleep_mode;
+  p.sleep_start = c.sleep_start;
+  p.sleep_end = c.sleep_end;
+
+  blob.header.magic = CONFIG_MAGIC;
+  blob.header.version = CONFIG_SCHEMA_VERSION;
+  blob.header.size = sizeof(ConfigPayloadV3);
+  blob.header.crc = config_crc32((const uint8_t*)&blob.payload, sizeof(blob.payload));
+}
+
+void config_from_v1(const ConfigPayloadV1& p, ClockConfig& c) {
+  c.show_seconds = p.show_seconds;
+  c.show_date = p.show_date;
+  c.color_scheme = p.color_scheme;
+  c.clock_face = p.clock_face;
+  c.segment_skew = p.segment_skew;
+  c.auto_brightness = p.auto_brightness;
+  c.day_brightness = p.day_brightness;
+  c.night_brightness = p.night_brightness;
+  c.transition_minutes = p.transition_minutes;
+  c.latitude = p.latitude;
+  c.longitude = p.longitude;
+  config_copy_str(c.timezone, sizeof(c.timezone), p.timezone, sizeof(p.timezone));
+  config_copy_str(c.wifi_ssid, sizeof(c.wifi_ssid), p.wifi_ssid, sizeof(p.wifi_ssid));
+  config_copy_str(c.wifi_pass, sizeof(c.wifi_pass), p.wifi_pass, sizeof(p.wifi_pass));
+  c.weather_enabled = p.weather_enabled;
+  config_copy_str(c.weather_api_key, sizeof(c.weather_api_key), p.weather_api_key, sizeof(p.weather_api_key));
+}
+
+void config_from_v2(const ConfigPayloadV2& p, ClockConfig& c) {
+  config_from_v1(p.v1, c);
+  memcpy(c.fade_ms, p.fade_ms, sizeof(c.fade_ms));
+  memcpy(c.fade_ease, p.fade_ease, sizeof(c.fade_ease));
+}
+
+// A blob with a good CRC can still hold values this build cannot draw (written
+// by another build, or before the POST handler clamped them). Clamp the fields
+// that index tables or size the layout, as the POST handler does.
+void config_sanitize(ClockConfig& c) {
+  if (c.color_scheme >= COLOR_SCHEME_COUNT) c.color_scheme = COLOR_SCHEME_COUNT - 1;
+  if (c.clock_face >= CLOCK_FACE_COUNT) c.clock_face = CLOCK_FACE_COUNT - 1;
+  if (c.segment_skew < 0) c.segment_skew = 0;
+  if (c.segment_skew > SEGMENT_SKEW_MAX) c.segment_skew = SEGMENT_SKEW_MAX;
+}
+
+// Validate a stored blob of `len` bytes and upgrade it to the current
+// ClockConfig, clamped by config_sanitize(). `c` is left untouched unless the
+// result is not CFG_DECODE_BAD.
+ConfigDecodeResult config_decode(const uint8_t* buf, size_t len, ClockConfig& c) {
+  if (len < sizeof(ConfigBlobHeader)) return CFG_DECODE_BAD;
+  ConfigBlobHeader h;
+  memcpy(&h, buf, sizeof(h));
+  const uint8_t* payload = buf + sizeof(h);
+  if (h.magic != CONFIG_MAGIC || sizeof(h) + h.size > len) return CFG_DECODE_BAD;
+  if (config_crc32(payload, h.size) != h.crc) return CFG_DECODE_BAD;
+
+  switch (h.version) {
+    case 1: {
+      if (h.size != sizeof(ConfigPayloadV1)) return CFG_DECODE_BAD;
+      ConfigPayloadV1 p;
+      memcpy(&p, payload, sizeof(p));
+      ClockConfig defaults;
+      config_from_v1(p, defaults);  // New fields keep their defaults
+      config_sanitize(defaults);
+      c = defaults;
+      return CFG_DECODE_MIGRATED;
+    }
+    case 2: {
+      if (h.size != sizeof(ConfigPayloadV2)) return CFG_DECODE_BAD;
+      ConfigPayloadV2 p;
+      memcpy(&p, payload, sizeof(p));
+      ClockConfig defaults;
+      config_from_v2(p, defaults);
+      config_sanitize(defaults);
+      c = defaults;
+      return CFG_DECODE_MIGRATED;
+    }
+    case 3: {
+      if (h.size != sizeof(ConfigPayloadV3)) return CFG_DECODE_BAD;
+      ConfigPayloadV3 p;
+      memcpy(&p, payload, sizeof(p));
+      config_from_v2(p.v2, c);
+      c.sleep_mode = p.sleep_mode;
+      c.sleep_start = p.sleep_start;
+      c.sleep_end = p.sleep_end;
+      config_sanitize(c);
+      return CFG_DECODE_OK;
+    }
+    default:
+      return CFG_DECODE_BAD;  // Written by newer firmware
+  }
+}
+
+#endif // CONFIG_STORE_H
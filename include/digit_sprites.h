@@ -0,0 +1,159 @@
+// ============================================================================
+// DIGIT SPRITES - Pre-blended 120px glyphs for the time row
+//
+// The time row only ever shows 0-9, ':', '-', 'A', 'P', 'M' and space. Instead
+// of letting LVGL decode 4bpp glyphs from ds_digib_120 and alpha-blend them on
+// every tick, each glyph is blended once per color scheme into a true-color
+// image in PSRAM. Time slots are plain lv_img objects, so a digit change is an
+// opaque image copy.
+//
+// Include this file in main.cpp after COLORS[] and the font declarations.
+// ============================================================================
+
+#ifndef DIGIT_SPRITES_H
+#define DIGIT_SPRITES_H
+
+#include <esp_heap_caps.h>
+
+static const char SPRITE_CHARS[] = " -0123456789:AMP";
+static const int SPRITE_COUNT = sizeof(SPRITE_CHARS) - 1;
+static const int SPRITE_SHADES = 2;  // [bright, dim] - same order as COLORS[]
+
+lv_img_dsc_t sprite_img[SPRITE_SHADES][SPRITE_COUNT];
+int sprite_scheme = -1;  // Color scheme the cache is blended for (-1 = not built)
+
+// Time row layout: "hh:mm:ss AM" - one image per character slot
+static const int TIME_SLOTS = 11;
+struct TimeSlot {
+  lv_obj_t* img;
+  char ch;        // '\0' = hidden
+  uint8_t shade;
+};
+TimeSlot time_slots[TIME_SLOTS];
+
+// Slots owned by each time field, indexed by DisplayField
+struct SlotSpan { uint8_t first, count, shade; };
+const SlotSpan FIELD_SLOTS[] = {
+  {0, 2, 0},  // FIELD_HOUR
+  {3, 2, 0},  // FIELD_MINUTE
+  {5, 1, 1},  // FIELD_COLON (minutes/seconds separator)
+  {6, 2, 0},  // FIELD_SECONDS
+  {8, 3, 0},  // FIELD_AMPM (" AM" or "AM")
+};
+static const uint8_t HOUR_COLON_SLOT = 2;
+
+int sprite_index(char ch) {
+  const char* p = strchr(SPRITE_CHARS, ch);
+  return (ch && p) ? (int)(p - SPRITE_CHARS) : 0;  // Anything unknown draws blank
+}
+
+// Blend every sprite glyph against black in both shades of a color scheme.
+// Buffers are allocated on the first build and re-blended in place afterwards,
+// so a scheme change never fragments PSRAM.
+bool sprite_cache_build(uint8_t scheme) {
+  const lv_font_t* font = &ds_digib_120;
+  uint16_t h = font->line_height;
+
+  for (int s = 0; s < SPRITE_SHADES; s++) {
+    // 4bpp alpha -> final RGB565 pixel, computed once per shade
+    lv_color_t lut[16];
+    for (int a = 0; a < 16; a++) {
+      lut[a] = lv_color_mix(COLORS[scheme][s], lv_color_black(), a * 17);
+    }
+
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+      uint32_t letter = (uint8_t)SPRITE_CHARS[i];
+      lv_font_glyph_dsc_t g = {};
+      if (!lv_font_get_glyph_dsc(font, &g, letter, 0)) g.adv_w = font->line_height / 2;
+      const uint8_t* bmp = g.box_w ? lv_font_get_glyph_bitmap(font, letter) : nullptr;
+
+      lv_img_dsc_t& img = sprite_img[s][i];
+      uint16_t w = g.adv_w ? g.adv_w : 1;
+      if (!img.data) {
+        uint32_t size = (uint32_t)w * h * sizeof(lv_color_t);
+        void* buf = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!buf) {
+          Serial.printf("❌ Sprite cache: PSRAM alloc of %u bytes failed\n", size);
+          return false;
+        }
+        img.header.always_zero = 0;
+        img.header.cf = LV_IMG_CF_TRUE_COLOR;
+        img.header.w = w;
+        img.header.h = h;
+        img.data_size = size;
+        img.data = (const uint8_t*)buf;
+      }
+
+      lv_color_t* px = (lv_color_t*)img.data;
+      for (uint32_t p = 0; p < (uint32_t)w * h; p++) px[p] = lut[0];
+      if (!bmp) continue;
+
+      // Same placement LVGL uses when drawing a letter on a line
+      int x0 = g.ofs_x;
+      int y0 = font->line_height - font->base_line - g.box_h - g.ofs_y;
+      for (int y = 0; y < g.box_h; y++) {
+        int dy = y0 + y;
+        if (dy < 0 || dy >= h) continue;
+        for (int x = 0; x < g.box_w; x++) {
+          int dx = x0 + x;
+          if (dx < 0 || dx >= w) continue;
+          uint32_t bit = (uint32_t)y * g.box_w + x;  // 4bpp rows are packed back to back
+          uint8_t a = (bit & 1) ? (bmp[bit >> 1] & 0x0F) : (bmp[bit >> 1] >> 4);
+          if (a) px[dy * w + dx] = lut[a];
+        }
+      }
+    }
+  }
+
+  sprite_scheme = scheme;
+  lv_img_cache_invalidate_src(nullptr);
+  Serial.printf("🖼️  Sprite cache built for color %d\n", scheme);
+  return true;
+}
+
+// Point one slot at a sprite. Returns the pixel area it invalidated (0 if unchanged).
+uint32_t sprite_slot_set(int slot, char ch, uint8_t shade) {
+  TimeSlot& ts = time_slots[slot];
+  if (ts.ch == ch && ts.shade == shade) return 0;
+  ts.ch = ch;
+  ts.shade = shade;
+  if (!ch) {
+    lv_obj_add_flag(ts.img, LV_OBJ_FLAG_HIDDEN);
+    return (uint32_t)lv_obj_get_width(ts.img) * lv_obj_get_height(ts.img);
+  }
+  const lv_img_dsc_t* img = &sprite_img[shade][sprite_index(ch)];
+  lv_img_set_src(ts.img, img);
+  lv_obj_clear_flag(ts.img, LV_OBJ_FLAG_HIDDEN);
+  return (uint32_t)img->header.w * img->header.h;
+}
+
+// Spread a field's text over its slots; slots past the end of the text are hidden
+uint32_t sprite_field_set(DisplayField field, const char* text) {
+  const SlotSpan& span = FIELD_SLOTS[field];
+  size_t len = strlen(text);
+  uint32_t px = 0;
+  for (int k = 0; k < span.count; k++) {
+    px += sprite_slot_set(span.first + k, k < (int)len ? text[k] : '\0', span.shade);
+  }
+  return px;
+}
+
+void sprite_row_create(lv_obj_t* row) {
+  for (int i = 0; i < TIME_SLOTS; i++) {
+    time_slots[i].img = lv_img_create(row);
+    time_slots[i].ch = '\0';
+    time_slots[i].shade = 0;
+    lv_obj_add_flag(time_slots[i].img, LV_OBJ_FLAG_HIDDEN);
+  }
+  sprite_cache_build(config.color_scheme);
+  sprite_slot_set(HOUR_COLON_SLOT, ':', 1);
+}
+
+// Re-blend the cache if the color scheme changed since it was built
+void sprite_cache_sync() {
+  if (sprite_scheme == config.color_scheme) return;
+  if (!sprite_cache_build(config.color_scheme)) return;
+  lv_obj_invalidate(row_time);
+}
+
+#endif // DIGIT_SPRITES_H
@@ -0,0 +1,51 @@
+// ============================================================================
+// MESSAGE QUEUE - Lock-free single-producer / single-consumer ring buffer
+//
+// Each worker task owns one queue into the render task, so pushes and pops
+// never take a lock and a slow producer can never stall the display. When a
+// queue is full the push is dropped (and counted) rather than blocking.
+// ============================================================================
+
+#ifndef MSG_QUEUE_H
+#define MSG_QUEUE_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+template <typename T, size_t N>
+class SpscQueue {
+  static_assert(N && (N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+public:
+  // Producer side only
+  bool push(const T& item) {
+    size_t head = head_.load(std::memory_order_relaxed);
+    if (head - tail_.load(std::memory_order_acquire) == N) {
+      dropped_++;
+      return false;
+    }
+    buf_[head & (N - 1)] = item;
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side only
+  bool pop(T& out) {
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail == head_.load(std::memory_order_acquire)) return false;
+    out = buf_[tail & (N - 1)];
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  uint32_t dropped() const { return dropped_; }
+
+private:
+  T buf_[N];
+  std::atomic<size_t> head_{0};
+  std::atomic<size_t> tail_{0};
+  uint32_t dropped_ = 0;
+};
+
+#endif // MSG_QUEUE_H
@@ -0,0 +1,182 @@
+// ============================================================================
+// NIGHT SLEEP - Panel off and deep sleep through a nightly window
+//
+// Inside the window (fixed times, or sunset to sunrise) the panel is put to
+// sleep and the S3 enters deep sleep until the window ends. A touch wakes it
+// for a NIGHT_PEEK_MS look at the time before it goes back to sleep.
+//
+// Deep sleep keeps the system time running on the RTC slow clock, so after
+// a wake the clock is valid as soon as setup() runs - no NTP wait. That
+// oscillator drifts by hundreds of ppm, so its rate error is learned from
+// the first NTP sync after each wake and taken off the next sleep's length
+// at wake-up. What has to survive deep sleep lives in RTC slow memory; the
+// learned rate is also kept in NVS for after a power cycle.
+//
+// Include this file in main.cpp after time_sync.h.
+// ============================================================================
+
+#ifndef NIGHT_SLEEP_H
+#define NIGHT_SLEEP_H
+
+#include <Preferences.h>
+#include <Update.h>
+#include <esp_sleep.h>
+
+// Touch controller INT (CST816 on the 1.91" board). -1 = wake on the timer only.
+#ifndef TOUCH_INT_PIN
+#define TOUCH_INT_PIN 21
+#endif
+
+enum SleepMode : uint8_t { SLEEP_OFF, SLEEP_FIXED, SLEEP_SUN };
+
+const uint32_t NIGHT_PEEK_MS = 30000;           // Stay awake this long after a touch
+const uint32_t NIGHT_BOOT_GRACE_MS = 120000;    // After power-on, time to reach the web UI
+const uint32_t NIGHT_CHECK_MS = 10000;
+const uint32_t NIGHT_MIN_SLEEP_S = 120;         // Not worth a reboot for less
+const uint32_t NIGHT_LEARN_WINDOW_MS = 900000;  // A sync later than this after waking is no drift sample
+const int64_t NIGHT_LEARN_MIN_SLEEP_US = 3600LL * 1000000;
+const float NIGHT_PPM_LIMIT = 20000.0f;
+const uint32_t NIGHT_RTC_MAGIC = 0x4E534C50;
+
+// Survives deep sleep (not a power cycle)
+struct NightRtc {
+  uint32_t magic;
+  int64_t entered_us;   // System time when we went to sleep
+  float ppm;            // RTC rate error, + = RTC runs fast
+};
+RTC_DATA_ATTR NightRtc night_rtc;
+
+struct NightSleep {
+  uint8_t cause = ESP_SLEEP_WAKEUP_UNDEFINED;
+  bool from_sleep = false;
+  bool learned = false;         // Drift sample taken for this wake
+  float ppm = 0;
+  int64_t slept_us = 0;         // Length of the last sleep, after correction
+  int32_t correction_ms = 0;    // Taken off the clock at wake-up
+  uint32_t awake_until = 0;     // millis() before which we do not sleep again
+  bool digits_pending = false;  // First valid time handed to LVGL, not yet flushed
+  uint32_t visible_ms = 0;      // Firmware start to first valid digits on screen
+};
+NightSleep night;
+lv_timer_t* night_timer = nullptr;
+
+const char* night_wake_name() {
+  switch (night.cause) {
+    case ESP_SLEEP_WAKEUP_TIMER: return "timer";
+    case ESP_SLEEP_WAKEUP_EXT0: return "touch";
+    default: return "power-on";
+  }
+}
+
+// Call first thing in setup(): undo the RTC drift of the sleep we woke from
+void night_sleep_boot() {
+  night.cause = esp_sleep_get_wakeup_cause();
+  bool woke = night.cause == ESP_SLEEP_WAKEUP_TIMER || night.cause == ESP_SLEEP_WAKEUP_EXT0;
+  if (woke && night_rtc.magic == NIGHT_RTC_MAGIC) {
+    night.from_sleep = true;
+    night.ppm = night_rtc.ppm;
+    int64_t now = now_us();
+    int64_t elapsed = now - night_rtc.entered_us;
+    int64_t correction = (int64_t)(elapsed * (double)night.ppm / 1e6);
+    int64_t corrected = now - correction;
+    struct timeval tv = {(time_t)(corrected / 1000000), (suseconds_t)(corrected % 1000000)};
+    settimeofday(&tv, nullptr);
+    night.slept_us = elapsed - correction;
+    night.correction_ms = (int32_t)(correction / 1000);
+    Serial.printf("🌙 Woke by %s after %lus, RTC drift %+.0fppm -> %+ldms\n", night_wake_name(),
+                  (unsigned long)(night.slept_us / 1000000), night.ppm, (long)-night.correction_ms);
+  } else {
+    Preferences p;
+    p.begin("night", true);
+    night.ppm = p.getFloat("ppm", 0.0f);
+    p.end();
+  }
+  night_rtc.magic = 0;  // A later reset must not re-apply this sleep
+  night.awake_until = night.cause == ESP_SLEEP_WAKEUP_EXT0 ? NIGHT_PEEK_MS
+                    : night.cause == ESP_SLEEP_WAKEUP_TIMER ? 0 : NIGHT_BOOT_GRACE_MS;
+}
+
+// After the first NTP sync following a wake: whatever offset is left is
+// the error of the ppm we used, spread over the sleep
+void night_sleep_learn() {
+  if (!night.from_sleep || night.learned) return;
+  night.learned = true;
+  if (millis() > NIGHT_LEARN_WINDOW_MS || night.slept_us < NIGHT_LEARN_MIN_SLEEP_US) return;
+  float measured = night.ppm - ntp_stats.offset_ms * 1000.0f * 1e6f / night.slept_us;
+  if (fabsf(measured) > NIGHT_PPM_LIMIT) return;
+  night.ppm = night.ppm == 0.0f ? measured : (night.ppm + measured) / 2;
+  Preferences p;
+  p.begin("night", false);
+  p.putFloat("ppm", night.ppm);
+  p.end();
+  Serial.printf("🌙 RTC drift now %+.0fppm (sync offset %lldms after %lus asleep)\n", night.ppm,
+                (long long)ntp_stats.offset_ms, (unsigned long)(night.slept_us / 1000000));
+}
+
+// Is local minute `now_min` inside the sleep window? `end_min` is where it ends.
+bool night_window(int now_min, int& end_min) {
+  int start;
+  if (config.sleep_mode == SLEEP_FIXED) {
+    start = config.sleep_start;
+    end_min = config.sleep_end;
+  } else if (config.sleep_mode == SLEEP_SUN) {
+    start = sunset_time;
+    end_min = sunrise_time;
+  } else {
+    return false;
+  }
+  if (start == end_min) return false;  // Also covers sun times not computed yet
+  return start < end_min ? (now_min >= start && now_min < end_min) : (now_min >= start || now_min < end_min);
+}
+
+void night_sleep_enter(uint32_t seconds) {
+  Serial.printf("🌙 Night sleep for %lum\n", (unsigned long)(seconds / 60));
+  Serial.flush();
+  amoled.setBrightness(0);
+  amoled.sleep();
+  night_rtc.magic = NIGHT_RTC_MAGIC;
+  night_rtc.entered_us = now_us();
+  night_rtc.ppm = night.ppm;
+  esp_sleep_enable_timer_wakeup((uint64_t)seconds * 1000000);
+#if TOUCH_INT_PIN >= 0
+  esp_sleep_enable_ext0_wakeup((gpio_num_t)TOUCH_INT_PIN, 0);
+#endif
+  esp_deep_sleep_start();
+}
+
+// Render task timer: go to sleep once inside the window and nothing needs us
+void night_check(lv_timer_t*) {
+  if (config.sleep_mode == SLEEP_OFF) return;
+  if ((int32_t)(millis() - night.awake_until) < 0 || Update.isRunning()) return;
+  ClockSnapshot now;
+  clock_now(&now);
+  if (!now.valid) return;
+  int now_min = now.tm.tm_hour * 60 + now.tm.tm_min;
+  int end_min;
+  if (!night_window(now_min, end_min)) return;
+  int32_t seconds = ((end_min - now_min + 1440) % 1440) * 60 - now.tm.tm_sec;
+  if (seconds < (int32_t)NIGHT_MIN_SLEEP_S) return;
+  night_sleep_enter(seconds);
+}
+
+// A touch or a config change keeps the clock up for a while
+void night_keep_awake() {
+  uint32_t until = millis() + NIGHT_PEEK_MS;
+  if ((int32_t)(until - night.awake_until) > 0) night.awake_until = until;
+}
+
+// Config bus subscriber (render task): a new window is only acted on after
+// a peek, so saving settings at night does not switch the clock off mid-edit
+void night_apply_config(uint32_t) {
+  night_keep_awake();
+}
+
+// Render task, after lv_timer_handler(): the first valid digits were flushed
+void night_note_visible() {
+  if (!night.digits_pending) return;
+  night.digits_pending = false;
+  night.visible_ms = millis();
+  Serial.printf("⏱️  Digits visible %lums after %s\n", (unsigned long)night.visible_ms, night_wake_name());
+}
+
+#endif // NIGHT_SLEEP_H
@@ -0,0 +1,192 @@
+// ============================================================================
+// PERF PROBES - Where the render and net loops spend their time
+//
+// A probe brackets one callback with two reads of the CPU cycle counter and
+// drops the duration into a log-scale histogram: 4 buckets per power of two
+// from 1us up to ~30s, so percentiles come out within ~20%. Histograms are
+// kept per PERF_SLICE_MS slice in a small ring, so /api/perf describes the
+// last minute rather than everything since boot, and each slice remembers
+// its largest sample and when it happened. Beside the ring, a coarse
+// cumulative histogram (powers of 4 from 16us) with count and sum is kept
+// since boot for /metrics, where Prometheus wants monotonic counters.
+//
+// Recording is a counter read, a clz and an increment. Each probe has a
+// single writer: the LVGL callbacks are recorded on the render task (core 1),
+// WiFi and the status stream on the net task (core 0). Both tasks are pinned,
+// so a probe's two cycle counts come from the same core, and there is no
+// locking; /api/perf reads the tables as is. HTTP requests are served on the
+// AsyncTCP task and are not probed.
+// Cycles are converted at the CPU frequency when the probe ends - with
+// frequency scaling on battery, a probe spanning a change is approximate.
+//
+// Build with -DPERF_PROBES=0 to compile the probes and /api/perf out.
+// ============================================================================
+
+#ifndef PERF_PROBE_H
+#define PERF_PROBE_H
+
+#ifndef PERF_PROBES
+#define PERF_PROBES 1
+#endif
+
+enum PerfProbeId : uint8_t {
+  PERF_LV_TIMER, PERF_DISPLAY, PERF_BRIGHTNESS, PERF_WIFI, PERF_STATUS_STREAM, PERF_PROBE_COUNT
+};
+
+#if PERF_PROBES
+
+const char* const PERF_NAMES[PERF_PROBE_COUNT] = {
+  "lv_timer_handler", "update_display", "update_brightness", "wifi_manager_poll", "status_stream_tick"
+};
+
+const int PERF_SUB_BITS = 2;                      // 4 buckets per octave
+const int PERF_BUCKETS = 24 << PERF_SUB_BITS;
+const int PERF_SLICES = 6;
+const uint32_t PERF_SLICE_MS = 10000;
+const int PERF_LE_COUNT = 10;                     // Cumulative bounds 16us * 4^i, plus +Inf
+
+struct PerfSlice {
+  uint32_t start_ms;
+  uint32_t max_us;
+  uint32_t max_at;                // millis() of the largest sample
+  uint16_t hist[PERF_BUCKETS];
+};
+
+struct PerfProbe {
+  uint8_t cur = 0;
+  PerfSlice slices[PERF_SLICES] = {};
+  // Since boot. seq is odd while an update is in progress (see perf_totals)
+  volatile uint32_t seq = 0;
+  uint32_t le[PERF_LE_COUNT + 1] = {};            // Not cumulative - summed when read
+  uint32_t count = 0;
+  uint64_t sum_us = 0;
+};
+PerfProbe perf_probes[PERF_PROBE_COUNT];
+
+// Exact below 8us, then 4 buckets per power of two
+int perf_bucket(uint32_t us) {
+  if (us < (2u << PERF_SUB_BITS)) return us;
+  int msb = 31 - __builtin_clz(us);
+  int b = ((msb - PERF_SUB_BITS + 1) << PERF_SUB_BITS) | ((us >> (msb - PERF_SUB_BITS)) & ((1 << PERF_SUB_BITS) - 1));
+  return b < PERF_BUCKETS ? b : PERF_BUCKETS - 1;
+}
+
+// Smallest duration that lands in bucket `b`
+uint32_t perf_bucket_floor(int b) {
+  int octave = b >> PERF_SUB_BITS, sub = b & ((1 << PERF_SUB_BITS) - 1);
+  return octave == 0 ? sub : (uint32_t)((1 << PERF_SUB_BITS) + sub) << (octave - 1);
+}
+
+// Upper bound of cumulative bucket i, in us
+uint32_t perf_le_us(int i) {
+  return 16u << (2 * i);
+}
+
+// Smallest i with us <= perf_le_us(i); PERF_LE_COUNT is +Inf
+int perf_le_index(uint32_t us) {
+  int log4 = us <= 1 ? 0 : (32 - __builtin_clz(us - 1) + 1) / 2;  // ceil(log4(us))
+  int i = log4 - 2;
+  return i < 0 ? 0 : (i > PERF_LE_COUNT ? PERF_LE_COUNT : i);
+}
+
+void perf_record(uint8_t id, uint32_t start_cycles) {
+  uint32_t us = (ESP.getCycleCount() - start_cycles) / ESP.getCpuFreqMHz();
+  uint32_t now = millis();
+  PerfProbe& p = perf_probes[id];
+  PerfSlice* s = &p.slices[p.cur];
+  if (now - s->start_ms >= PERF_SLICE_MS) {
+    p.cur = (p.cur + 1) % PERF_SLICES;
+    s = &p.slices[p.cur];
+    memset(s, 0, sizeof(*s));
+    s->start_ms = now;
+  }
+  uint16_t& n = s->hist[perf_bucket(us)];
+  if (n < UINT16_MAX) n++;
+  if (us >= s->max_us) {
+    s->max_us = us;
+    s->max_at = now;
+  }
+  p.seq++;
+  __sync_synchronize();
+  p.le[perf_le_index(us)]++;
+  p.sum_us += us;
+  p.count++;
+  __sync_synchronize();
+  p.seq++;
+}
+
+struct PerfTotals {
+  uint32_t le[PERF_LE_COUNT + 1];   // Cumulative, as Prometheus wants them
+  uint32_t count;
+  uint64_t sum_us;
+};
+
+// Consistent copy of the since-boot histogram, retried if the owning task
+// recorded in the middle of it
+void perf_totals(uint8_t id, PerfTotals& out) {
+  const PerfProbe& p = perf_probes[id];
+  uint32_t seq;
+  do {
+    seq = p.seq;
+    __sync_synchronize();
+    uint32_t acc = 0;
+    for (int i = 0; i <= PERF_LE_COUNT; i++) out.le[i] = acc += p.le[i];
+    out.count = p.count;
+    out.sum_us = p.sum_us;
+    __sync_synchronize();
+  } while ((seq & 1) || seq != p.seq);
+}
+
+// Times the enclosing block
+struct PerfScope {
+  uint8_t id;
+  uint32_t start;
+  explicit PerfScope(uint8_t probe) : id(probe), start(ESP.getCycleCount()) {}
+  ~PerfScope() { perf_record(id, start); }
+};
+#define PERF_SCOPE(id) PerfScope perf_scope_##id(id)
+
+struct PerfSummary {
+  uint32_t count;
+  uint32_t p50_us;
+  uint32_t p99_us;
+  uint32_t max_us;
+  uint32_t max_age_ms;
+};
+
+// Merge the slices still inside the window (percentiles are bucket tops)
+void perf_summary(uint8_t id, PerfSummary& out) {
+  uint32_t hist[PERF_BUCKETS] = {0};
+  uint32_t now = millis();
+  out = {};
+  const PerfProbe& p = perf_probes[id];
+  for (const PerfSlice& s : p.slices) {
+    if (now - s.start_ms >= PERF_SLICES * PERF_SLICE_MS) continue;
+    for (int b = 0; b < PERF_BUCKETS; b++) {
+      hist[b] += s.hist[b];
+      out.count += s.hist[b];
+    }
+    if (s.max_us >= out.max_us) {
+      out.max_us = s.max_us;
+      out.max_age_ms = now - s.max_at;
+    }
+  }
+  if (!out.count) return;
+  uint32_t seen = 0, p50 = (out.count + 1) / 2, p99 = out.count - out.count / 100;
+  for (int b = 0; b < PERF_BUCKETS; b++) {
+    uint32_t before = seen;
+    seen += hist[b];
+    uint32_t top = min(perf_bucket_floor(b + 1) - 1, out.max_us);
+    if (before < p50 && seen >= p50) out.p50_us = top;
+    if (before < p99 && seen >= p99) {
+      out.p99_us = top;
+      break;
+    }
+  }
+}
+
+#else
+#define PERF_SCOPE(id) do {} while (0)
+#endif // PERF_PROBES
+
+#endif // PERF_PROBE_H
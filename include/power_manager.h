@@ -0,0 +1,130 @@
+// ============================================================================
+// POWER MANAGER - Light sleep and frequency scaling while on battery
+//
+// On USB the CPU stays locked at 240MHz, as it always was. Once the charger
+// reports no VBUS and no charge in progress, esp_pm is reconfigured to scale
+// the CPU down to 40MHz and to enter automatic light sleep whenever every
+// task is blocked. The render task sleeps until the next LVGL timer
+// deadline, so between ticks the chip has nothing to do. WiFi stays
+// associated in modem sleep (it wakes for DTIM beacons), so the web server
+// remains reachable.
+//
+// A board without a BQ25896 is treated as USB powered: its register mirror
+// is all zeros, which would otherwise read as "no VBUS, not charging".
+//
+// All of this needs esp_pm in the SDK build. The stock espressif32 Arduino
+// framework ships with CONFIG_PM_ENABLE and tickless idle off. On that build
+// the CPU stays at 240MHz on battery too, and the log and /api/status ("pm")
+// say power management is unavailable. With CONFIG_PM_ENABLE but no tickless
+// idle, only frequency scaling is used.
+//
+// Awake time is measured by the tasks themselves (from waking to blocking
+// again, summed over both cores - WiFi/TCP stack time is not included). The
+// current figure is an estimate built from that and the panel brightness.
+//
+// Include this file in main.cpp after the battery management section.
+// ============================================================================
+
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <atomic>
+#include <esp_pm.h>
+#include <esp_sleep.h>
+#include <driver/gpio.h>
+#include <sdkconfig.h>
+
+const int POWER_MAX_MHZ = 240;
+const int POWER_MIN_MHZ = 40;                // XTAL - the lowest DFS step
+const uint32_t POWER_WINDOW_MS = 10000;      // Awake % is averaged over this
+
+// Rough battery-side current model for the estimate (mA)
+const float POWER_MA_AWAKE = 45.0f;          // CPU running at 240MHz
+const float POWER_MA_IDLE_FULL = 28.0f;      // Idle, locked at 240MHz (USB)
+const float POWER_MA_IDLE_DFS = 12.0f;       // Idle at 40MHz, no light sleep
+const float POWER_MA_LIGHT_SLEEP = 2.5f;     // Light sleep, WiFi associated (beacons averaged in)
+const float POWER_MA_PANEL_FULL = 20.0f;     // Panel at 255 showing the mostly black face
+
+struct PowerState {
+  volatile bool on_battery = false;
+  volatile bool light_sleep = false;         // esp_pm accepted light sleep
+  volatile bool dfs = false;                 // esp_pm accepted frequency scaling
+  volatile bool pm_available = false;        // esp_pm is in the SDK build and accepted a config
+  std::atomic<uint32_t> busy_us{0};          // Task run time in the current window
+  uint32_t window_start = 0;
+  volatile float awake_pct = 100.0f;         // Last complete window
+};
+PowerState power;
+
+// Time a task spent awake since `start` (a micros() taken when it woke)
+void power_busy(uint32_t start) {
+  power.busy_us.fetch_add(micros() - start);
+}
+
+void power_apply(bool battery) {
+#ifdef CONFIG_PM_ENABLE
+  esp_pm_config_esp32s3_t pm = {};
+  pm.max_freq_mhz = POWER_MAX_MHZ;
+  pm.min_freq_mhz = battery ? POWER_MIN_MHZ : POWER_MAX_MHZ;
+  pm.light_sleep_enable = battery;
+  esp_err_t err = esp_pm_configure(&pm);
+  if (err == ESP_ERR_NOT_SUPPORTED && battery) {
+    pm.light_sleep_enable = false;  // No tickless idle in this SDK build
+    err = esp_pm_configure(&pm);
+  }
+  bool light_sleep = pm.light_sleep_enable;
+#else
+  esp_err_t err = ESP_ERR_NOT_SUPPORTED;  // esp_pm is compiled out of this SDK build
+  bool light_sleep = false;
+#endif
+  power.pm_available = err == ESP_OK;
+  power.on_battery = battery;
+  power.dfs = battery && err == ESP_OK;
+  power.light_sleep = power.dfs && light_sleep;
+
+  if (!battery) Serial.println("🔌 Power: USB - CPU locked at 240MHz");
+  else if (err != ESP_OK) Serial.printf("⚠️  Power: battery, but no power management in this SDK build (%d) - "
+                                        "CPU stays at 240MHz, no light sleep\n", err);
+  else Serial.printf("🔋 Power: battery - %d-%dMHz%s\n", POWER_MIN_MHZ, POWER_MAX_MHZ,
+                     power.light_sleep ? ", light sleep" : ", no light sleep");
+}
+
+void power_begin() {
+#if BQ_INT_PIN >= 0
+  // A charger interrupt (e.g. VBUS plugged in) must end a light sleep
+  gpio_wakeup_enable((gpio_num_t)BQ_INT_PIN, GPIO_INTR_LOW_LEVEL);
+  esp_sleep_enable_gpio_wakeup();
+#endif
+  power.window_start = millis();
+}
+
+// Called by the charger task after each status refresh. Returns true when
+// the power source changed (and on the first call). Without a charger there
+// is no way to tell, so the board is taken to be on external power.
+bool power_update(bool charger_present, bool vbus, bool charging) {
+  bool battery = charger_present && !vbus && !charging;
+  static bool applied = false;
+  if (applied && battery == power.on_battery) return false;
+  applied = true;
+  power_apply(battery);
+  return true;
+}
+
+// Close the awake-time window once it is complete
+void power_roll() {
+  uint32_t now = millis();
+  uint32_t elapsed = now - power.window_start;
+  if (elapsed < POWER_WINDOW_MS) return;
+  float pct = power.busy_us.exchange(0) / (elapsed * 10.0f);
+  power.awake_pct = pct > 100.0f ? 100.0f : pct;
+  power.window_start = now;
+}
+
+// Battery current estimate from awake time, sleep mode and panel level
+float power_estimate_ma(uint8_t panel_level) {
+  float idle = power.light_sleep ? POWER_MA_LIGHT_SLEEP : (power.dfs ? POWER_MA_IDLE_DFS : POWER_MA_IDLE_FULL);
+  float awake = power.awake_pct / 100.0f;
+  return awake * POWER_MA_AWAKE + (1.0f - awake) * idle + POWER_MA_PANEL_FULL * panel_level / 255.0f;
+}
+
+#endif // POWER_MANAGER_H
@@ -0,0 +1,214 @@
+// ============================================================================
+// SEVEN SEGMENT - Vector 7-segment time row (no font flash)
+//
+// Each digit is drawn from up to seven hexagonal segments with lv_draw_polygon.
+// Segment outlines are defined on a 24x44 design grid and scaled to the digit
+// height at startup, so any size works without generating a font. When a slot
+// changes value only the segments that toggled are invalidated.
+//
+// Uses the slot layout (TIME_SLOTS / FIELD_SLOTS) from digit_sprites.h.
+// ============================================================================
+
+#ifndef SEVEN_SEGMENT_H
+#define SEVEN_SEGMENT_H
+
+//   aaa
+//  f   b
+//   ggg
+//  e   c
+//   ddd
+enum Segment : uint8_t { SEG_A, SEG_B, SEG_C, SEG_D, SEG_E, SEG_F, SEG_G, SEG_COUNT };
+
+constexpr uint8_t seg_bits(bool a, bool b, bool c, bool d, bool e, bool f, bool g) {
+  return (a << SEG_A) | (b << SEG_B) | (c << SEG_C) | (d << SEG_D) |
+         (e << SEG_E) | (f << SEG_F) | (g << SEG_G);
+}
+
+// Lit segments for every character the time row can show
+constexpr uint8_t SEG_DIGITS[10] = {
+  seg_bits(1, 1, 1, 1, 1, 1, 0),  // 0
+  seg_bits(0, 1, 1, 0, 0, 0, 0),  // 1
+  seg_bits(1, 1, 0, 1, 1, 0, 1),  // 2
+  seg_bits(1, 1, 1, 1, 0, 0, 1),  // 3
+  seg_bits(0, 1, 1, 0, 0, 1, 1),  // 4
+  seg_bits(1, 0, 1, 1, 0, 1, 1),  // 5
+  seg_bits(1, 0, 1, 1, 1, 1, 1),  // 6
+  seg_bits(1, 1, 1, 0, 0, 0, 0),  // 7
+  seg_bits(1, 1, 1, 1, 1, 1, 1),  // 8
+  seg_bits(1, 1, 1, 1, 0, 1, 1),  // 9
+};
+constexpr uint8_t SEG_DASH = seg_bits(0, 0, 0, 0, 0, 0, 1);
+constexpr uint8_t SEG_LETTER_A = seg_bits(1, 1, 1, 0, 1, 1, 1);
+constexpr uint8_t SEG_LETTER_P = seg_bits(1, 1, 0, 0, 1, 1, 1);
+static_assert(SEG_DIGITS[8] == 0x7F, "8 lights every segment");
+
+// Segment outlines on the design grid: 24 wide, 44 tall, 4 thick, 1 unit gap
+static const int SEG_GRID_W = 24;
+static const int SEG_GRID_H = 44;
+struct SegOutline { int8_t x[6], y[6]; };
+constexpr SegOutline SEG_OUTLINES[SEG_COUNT] = {
+  {{ 3,  5, 19, 21, 19,  5}, { 2,  0,  0,  2,  4,  4}},  // a
+  {{22, 24, 24, 22, 20, 20}, { 3,  5, 19, 21, 19,  5}},  // b
+  {{22, 24, 24, 22, 20, 20}, {23, 25, 39, 41, 39, 25}},  // c
+  {{ 3,  5, 19, 21, 19,  5}, {42, 40, 40, 42, 44, 44}},  // d
+  {{ 2,  4,  4,  2,  0,  0}, {23, 25, 39, 41, 39, 25}},  // e
+  {{ 2,  4,  4,  2,  0,  0}, { 3,  5, 19, 21, 19,  5}},  // f
+  {{ 3,  5, 19, 21, 19,  5}, {22, 20, 20, 22, 24, 24}},  // g
+};
+
+// Returns the segment mask for a character, or -1 if it cannot be shown
+int segment_mask(char ch) {
+  if (ch >= '0' && ch <= '9') return SEG_DIGITS[ch - '0'];
+  switch (ch) {
+    case ' ': return 0;
+    case '-': return SEG_DASH;
+    case 'A': return SEG_LETTER_A;
+    case 'P': return SEG_LETTER_P;
+    default:  return -1;  // 'M' has no 7-segment form - A/P alone reads fine
+  }
+}
+
+// Scaled geometry, relative to the top-left of a digit slot
+lv_point_t seg_points[SEG_COUNT][6];
+lv_area_t seg_boxes[SEG_COUNT];
+lv_coord_t seg_digit_w = 0, seg_digit_h = 0, seg_colon_w = 0;
+
+struct SegSlot {
+  lv_obj_t* obj;
+  int16_t mask;   // -1 = hidden
+  uint8_t shade;
+  bool colon;
+};
+SegSlot seg_slots[TIME_SLOTS];
+int seg_scheme = -1;
+
+void segment_geometry(lv_coord_t height, int8_t skew) {
+  seg_digit_h = height;
+  seg_digit_w = SEG_GRID_W * height / SEG_GRID_H + abs(skew);
+  seg_colon_w = 4 * height / SEG_GRID_H + abs(skew) / 2 + 2;
+  for (int s = 0; s < SEG_COUNT; s++) {
+    lv_area_t& box = seg_boxes[s];
+    box.x1 = box.y1 = LV_COORD_MAX;
+    box.x2 = box.y2 = LV_COORD_MIN;
+    for (int p = 0; p < 6; p++) {
+      int gy = SEG_OUTLINES[s].y[p];
+      // Lean the top of the digit right by `skew` px, pivoting on the baseline
+      lv_coord_t x = SEG_OUTLINES[s].x[p] * height / SEG_GRID_H + (skew > 0 ? 0 : -skew) +
+                     skew * (SEG_GRID_H - gy) / SEG_GRID_H;
+      lv_coord_t y = gy * height / SEG_GRID_H;
+      seg_points[s][p] = {x, y};
+      box.x1 = LV_MIN(box.x1, x); box.x2 = LV_MAX(box.x2, x);
+      box.y1 = LV_MIN(box.y1, y); box.y2 = LV_MAX(box.y2, y);
+    }
+  }
+}
+
+static void segment_draw_cb(lv_event_t* e) {
+  lv_obj_t* obj = lv_event_get_target(e);
+  lv_draw_ctx_t* draw_ctx = lv_event_get_draw_ctx(e);
+  const SegSlot& slot = seg_slots[(intptr_t)lv_obj_get_user_data(obj)];
+  if (slot.mask <= 0 && !slot.colon) return;
+
+  lv_draw_rect_dsc_t dsc;
+  lv_draw_rect_dsc_init(&dsc);
+  dsc.bg_color = COLORS[config.color_scheme][slot.shade];
+  dsc.bg_opa = LV_OPA_COVER;
+
+  lv_coord_t ox = obj->coords.x1, oy = obj->coords.y1;
+  if (slot.colon) {
+    lv_coord_t dot = 4 * seg_digit_h / SEG_GRID_H;
+    for (int i = 1; i <= 2; i++) {
+      lv_coord_t cy = oy + seg_digit_h * (i == 1 ? 13 : 31) / SEG_GRID_H;
+      lv_area_t a = {(lv_coord_t)(ox + 1), (lv_coord_t)(cy - dot / 2),
+                     (lv_coord_t)(ox + dot), (lv_coord_t)(cy + dot / 2)};
+      lv_draw_rect(draw_ctx, &dsc, &a);
+    }
+    return;
+  }
+
+  for (int s = 0; s < SEG_COUNT; s++) {
+    if (!(slot.mask & (1 << s))) continue;
+    lv_area_t box = seg_boxes[s];
+    lv_area_move(&box, ox, oy);
+    lv_area_t clip;
+    if (!_lv_area_intersect(&clip, &box, draw_ctx->clip_area)) continue;
+    lv_point_t pts[6];
+    for (int p = 0; p < 6; p++) pts[p] = {(lv_coord_t)(seg_points[s][p].x + ox),
+                                          (lv_coord_t)(seg_points[s][p].y + oy)};
+    lv_draw_polygon(draw_ctx, &dsc, pts, 6);
+  }
+}
+
+// Invalidate only the segments that differ between two masks
+uint32_t segment_invalidate(lv_obj_t* obj, uint8_t toggled) {
+  uint32_t px = 0;
+  for (int s = 0; s < SEG_COUNT; s++) {
+    if (!(toggled & (1 << s))) continue;
+    lv_area_t box = seg_boxes[s];
+    lv_area_move(&box, obj->coords.x1, obj->coords.y1);
+    lv_obj_invalidate_area(obj, &box);
+    px += lv_area_get_size(&box);
+  }
+  return px;
+}
+
+// Returns the pixel area invalidated (0 if unchanged)
+uint32_t segment_slot_set(int slot, char ch, uint8_t shade) {
+  SegSlot& ss = seg_slots[slot];
+  int16_t mask = ch ? segment_mask(ch) : -1;
+  if (ss.colon) mask = ch ? 0 : -1;
+  if (ss.mask == mask && ss.shade == shade) return 0;
+
+  bool was_hidden = ss.mask < 0;
+  int16_t old = ss.mask;
+  ss.mask = mask;
+  ss.shade = shade;
+  if (mask < 0) {
+    lv_obj_add_flag(ss.obj, LV_OBJ_FLAG_HIDDEN);
+    return (uint32_t)lv_obj_get_width(ss.obj) * seg_digit_h;
+  }
+  if (was_hidden) {
+    // Showing a slot reflows the row, so the whole slot is dirty anyway
+    lv_obj_clear_flag(ss.obj, LV_OBJ_FLAG_HIDDEN);
+    return (uint32_t)lv_obj_get_width(ss.obj) * seg_digit_h;
+  }
+  return segment_invalidate(ss.obj, ss.colon ? 0 : (uint8_t)(old ^ mask));
+}
+
+uint32_t segment_field_set(DisplayField field, const char* text) {
+  const SlotSpan& span = FIELD_SLOTS[field];
+  size_t len = strlen(text);
+  uint32_t px = 0;
+  for (int k = 0; k < span.count; k++) {
+    px += segment_slot_set(span.first + k, k < (int)len ? text[k] : '\0', span.shade);
+  }
+  return px;
+}
+
+void segment_row_create(lv_obj_t* row, lv_coord_t height, int8_t skew) {
+  segment_geometry(height, skew);
+  for (int i = 0; i < TIME_SLOTS; i++) {
+    SegSlot& ss = seg_slots[i];
+    ss.colon = (i == HOUR_COLON_SLOT || i == FIELD_SLOTS[FIELD_COLON].first);
+    ss.mask = -1;
+    ss.shade = 0;
+    ss.obj = lv_obj_create(row);
+    lv_obj_remove_style_all(ss.obj);
+    lv_obj_clear_flag(ss.obj, LV_OBJ_FLAG_CLICKABLE);  // Taps fall through to the screen
+    lv_obj_set_size(ss.obj, ss.colon ? seg_colon_w : seg_digit_w, seg_digit_h);
+    lv_obj_set_user_data(ss.obj, (void*)(intptr_t)i);
+    lv_obj_add_event_cb(ss.obj, segment_draw_cb, LV_EVENT_DRAW_MAIN, nullptr);
+    lv_obj_add_flag(ss.obj, LV_OBJ_FLAG_HIDDEN);
+  }
+  seg_scheme = config.color_scheme;
+  segment_slot_set(HOUR_COLON_SLOT, ':', 1);
+}
+
+// Colors are read at draw time, so a scheme change is just a repaint
+void segment_color_sync() {
+  if (seg_scheme == config.color_scheme) return;
+  seg_scheme = config.color_scheme;
+  lv_obj_invalidate(row_time);
+}
+
+#endif // SEVEN_SEGMENT_H
@@ -0,0 +1,134 @@
+// ============================================================================
+// SUN TABLE - Sunrise/sunset for every day of the year, kept in NVS
+//
+// The solar calculation only depends on the date and the location, so it is
+// run for all 366 calendar days when the location changes and the result is
+// stored in NVS. Entries are minutes after 00:00 UTC of that date, which
+// makes the table independent of the timezone: lookups turn them into epoch
+// times and localtime_r() applies the configured TZ, DST included. Year to
+// year the events drift by well under a minute, so one table serves every year.
+//
+// Include this file in main.cpp after ClockConfig.
+// ============================================================================
+
+#ifndef SUN_TABLE_H
+#define SUN_TABLE_H
+
+#include <Preferences.h>
+#include <math.h>
+#include <time.h>
+
+const int SUN_TABLE_DAYS = 366;              // Indexed as a leap year, Feb 29 included
+const int16_t SUN_NONE = INT16_MIN;          // Polar day/night - no event that date
+const uint8_t SUN_TABLE_VERSION = 1;
+
+struct SunTable {
+  uint8_t version;
+  float latitude;
+  float longitude;
+  int16_t rise[SUN_TABLE_DAYS];   // Minutes after 00:00 UTC (may be <0 or >1440)
+  int16_t set[SUN_TABLE_DAYS];
+};
+SunTable sun_table;
+bool sun_table_ready = false;
+
+double julian_day(int y, int m, int d) {
+  int a = (14 - m) / 12;
+  int yy = y + 4800 - a;
+  int mm = m + 12 * a - 3;
+  return d + (153 * mm + 2) / 5 + 365 * yy + yy / 4 - yy / 100 + yy / 400 - 32045;
+}
+
+// Sunrise/sunset of one calendar date, in minutes after 00:00 UTC of that date
+void calculate_sun_times(int year, int month, int day, float lat, float lon, int16_t& rise, int16_t& set) {
+  double jd = julian_day(year, month, day);
+  double n = jd - 2451545.0 + 0.0008;
+  double j_star = n - lon / 360.0;
+  double M = fmod(357.5291 + 0.98560028 * j_star, 360.0) * M_PI / 180.0;
+  double C = 1.9148 * sin(M) + 0.0200 * sin(2 * M) + 0.0003 * sin(3 * M);
+  double lambda = fmod(280.4665 + 0.98564736 * j_star + C, 360.0);
+  double j_transit = 2451545.0 + j_star + 0.0053 * sin(M) - 0.0069 * sin(2 * lambda * M_PI / 180.0);
+  double delta = asin(sin(lambda * M_PI / 180.0) * sin(23.44 * M_PI / 180.0));
+  double cos_omega = (sin(-0.833 * M_PI / 180.0) - sin(lat * M_PI / 180.0) * sin(delta)) /
+                     (cos(lat * M_PI / 180.0) * cos(delta));
+  if (cos_omega < -1.0 || cos_omega > 1.0) {
+    rise = set = SUN_NONE;
+    return;
+  }
+  double omega = acos(cos_omega) * 180.0 / M_PI;
+  // jd is the Julian day number, i.e. noon UTC of the date; midnight is jd - 0.5
+  rise = (int16_t)lround((j_transit - omega / 360.0 - (jd - 0.5)) * 1440.0);
+  set = (int16_t)lround((j_transit + omega / 360.0 - (jd - 0.5)) * 1440.0);
+}
+
+// Table slot for a date: day of a leap year, so Mar 1 is always slot 60
+int sun_table_index(int year, int mon, int yday) {
+  bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+  return (!leap && mon >= 2) ? yday + 1 : yday;
+}
+
+void sun_table_build(float lat, float lon) {
+  uint32_t start = millis();
+  const int days_in_month[] = {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  int i = 0;
+  for (int m = 1; m <= 12; m++) {
+    for (int d = 1; d <= days_in_month[m - 1]; d++, i++) {
+      calculate_sun_times(2024, m, d, lat, lon, sun_table.rise[i], sun_table.set[i]);
+    }
+  }
+  sun_table.version = SUN_TABLE_VERSION;
+  sun_table.latitude = lat;
+  sun_table.longitude = lon;
+  sun_table_ready = true;
+
+  Preferences p;
+  p.begin("sun", false);
+  p.putBytes("tbl", &sun_table, sizeof(sun_table));
+  p.end();
+  Serial.printf("🌅 Sun table built for %.4f, %.4f in %lums\n", lat, lon, (unsigned long)(millis() - start));
+}
+
+// Load the stored table, rebuilding it if it was made for another location
+void sun_table_ensure(float lat, float lon) {
+  if (sun_table_ready && sun_table.latitude == lat && sun_table.longitude == lon) return;
+  Preferences p;
+  p.begin("sun", true);
+  size_t len = p.getBytes("tbl", &sun_table, sizeof(sun_table));
+  p.end();
+  if (len == sizeof(sun_table) && sun_table.version == SUN_TABLE_VERSION &&
+      sun_table.latitude == lat && sun_table.longitude == lon) {
+    sun_table_ready = true;
+    return;
+  }
+  sun_table_build(lat, lon);
+}
+
+// Epoch times of sunrise and sunset on the local calendar date in `day`.
+// Returns false during polar day/night.
+bool sun_events(const struct tm& day, time_t& rise, time_t& set) {
+  int i = sun_table_index(day.tm_year + 1900, day.tm_mon, day.tm_yday);
+  if (sun_table.rise[i] == SUN_NONE) return false;
+  time_t midnight_utc = (time_t)(julian_day(day.tm_year + 1900, day.tm_mon + 1, day.tm_mday) - 2440588) * 86400;
+  rise = midnight_utc + sun_table.rise[i] * 60;
+  set = midnight_utc + sun_table.set[i] * 60;
+  return true;
+}
+
+// The next sunrise or sunset after `now`, or 0 if there is none in the next two days
+time_t sun_next_transition(time_t now) {
+  struct tm day;
+  localtime_r(&now, &day);
+  for (int k = 0; k < 2; k++) {
+    time_t rise, set;
+    if (sun_events(day, rise, set)) {
+      if (rise > now) return rise;
+      if (set > now) return set;
+    }
+    day.tm_mday++;
+    day.tm_isdst = -1;
+    mktime(&day);  // Normalize to tomorrow (fills tm_yday)
+  }
+  return 0;
+}
+
+#endif // SUN_TABLE_H
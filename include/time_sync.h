@@ -0,0 +1,162 @@
+// ============================================================================
+// TIME SYNC - Non-blocking SNTP client
+//
+// Replaces the configTzTime() + busy-wait in setup_time(). One request is in
+// flight at a time; time_sync_poll() only checks for a reply or a timeout, so
+// the net task keeps serving the web UI while a server is slow. Servers are
+// tried in order and the first one to answer wins. Offset and round-trip time
+// come from the standard NTP four-timestamp exchange.
+//
+// Include this file in main.cpp and call time_sync_poll() from the net task.
+// ============================================================================
+
+#ifndef TIME_SYNC_H
+#define TIME_SYNC_H
+
+#include <WiFiUdp.h>
+#include <sys/time.h>
+
+// Local Starlink server first, then public fallbacks
+const char* const NTP_SERVERS[] = {"192.168.100.1", "time.cloudflare.com", "time.google.com"};
+const int NTP_SERVER_COUNT = sizeof(NTP_SERVERS) / sizeof(NTP_SERVERS[0]);
+
+const uint32_t NTP_REPLY_TIMEOUT_MS = 1500;
+const uint32_t NTP_RESYNC_MS = 3600000;   // Hourly once synced
+const uint32_t NTP_RETRY_MS = 60000;      // After every server failed
+const uint64_t NTP_UNIX_OFFSET = 2208988800ULL;  // 1900 -> 1970
+
+enum TimeSyncState : uint8_t { SYNC_IDLE, SYNC_WAITING, SYNC_SLEEPING };
+
+// Sync-state flag and results - read by the UI and web API
+volatile bool time_synced = false;
+struct TimeSyncStats {
+  int64_t offset_ms = 0;    // Clock correction applied by the last sync (huge on the first one)
+  uint32_t rtt_ms = 0;      // Round-trip delay of the last sync
+  int8_t server = -1;       // Index into NTP_SERVERS of the server that answered
+  uint32_t synced_at = 0;   // millis() of the last sync
+  uint32_t count = 0;
+};
+TimeSyncStats ntp_stats;
+
+struct TimeSync {
+  WiFiUDP udp;
+  uint8_t state = SYNC_IDLE;
+  int server = 0;
+  uint32_t sent_at = 0;      // millis() the request left
+  uint32_t next_at = 0;      // millis() of the next sync round
+  uint8_t tx_stamp[8];       // Our transmit timestamp, echoed back as originate
+  int64_t t1_us = 0;         // Local time the request left
+};
+TimeSync ntp;
+
+int64_t now_us() {
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+// NTP 32.32 fixed point (since 1900) <-> Unix microseconds
+int64_t ntp_to_us(const uint8_t* p) {
+  uint32_t sec = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+  uint32_t frac = ((uint32_t)p[4] << 24) | ((uint32_t)p[5] << 16) | ((uint32_t)p[6] << 8) | p[7];
+  return ((int64_t)sec - (int64_t)NTP_UNIX_OFFSET) * 1000000 + (((uint64_t)frac * 1000000) >> 32);
+}
+
+void us_to_ntp(int64_t us, uint8_t* p) {
+  uint32_t sec = (uint32_t)(us / 1000000 + NTP_UNIX_OFFSET);
+  uint32_t frac = (uint32_t)(((uint64_t)(us % 1000000) << 32) / 1000000);
+  for (int i = 0; i < 4; i++) {
+    p[i] = sec >> (24 - 8 * i);
+    p[4 + i] = frac >> (24 - 8 * i);
+  }
+}
+
+void time_sync_send() {
+  uint8_t pkt[48] = {0};
+  pkt[0] = 0x23;  // LI=0, VN=4, Mode=3 (client)
+  ntp.t1_us = now_us();
+  us_to_ntp(ntp.t1_us, ntp.tx_stamp);
+  memcpy(pkt + 40, ntp.tx_stamp, 8);
+
+  while (ntp.udp.parsePacket() > 0) ntp.udp.flush();  // Drop stale replies
+  ntp.udp.beginPacket(NTP_SERVERS[ntp.server], 123);
+  ntp.udp.write(pkt, sizeof(pkt));
+  ntp.udp.endPacket();
+  ntp.sent_at = millis();
+  ntp.state = SYNC_WAITING;
+}
+
+// Start a sync round now (e.g. right after WiFi comes up)
+void time_sync_start() {
+  if (!ntp.udp.begin(0)) {  // Any local port
+    ntp.next_at = millis() + NTP_RETRY_MS;
+    ntp.state = SYNC_SLEEPING;
+    return;
+  }
+  ntp.server = 0;
+  time_sync_send();
+}
+
+// Parse a reply, apply the offset. Returns false if the packet is not ours.
+bool time_sync_receive() {
+  uint8_t pkt[48];
+  if (ntp.udp.read(pkt, sizeof(pkt)) != (int)sizeof(pkt)) return false;
+  int64_t t4 = now_us();
+  if ((pkt[0] & 0x07) != 4 || pkt[1] == 0) return false;        // Not a server reply / kiss-o'-death
+  if (memcmp(pkt + 24, ntp.tx_stamp, 8) != 0) return false;      // Not an answer to our request
+
+  int64_t t1 = ntp.t1_us;
+  int64_t t2 = ntp_to_us(pkt + 32);
+  int64_t t3 = ntp_to_us(pkt + 40);
+  int64_t offset = ((t2 - t1) + (t3 - t4)) / 2;
+  int64_t delay = (t4 - t1) - (t3 - t2);
+
+  int64_t corrected = now_us() + offset;
+  struct timeval tv = {(time_t)(corrected / 1000000), (suseconds_t)(corrected % 1000000)};
+  settimeofday(&tv, nullptr);
+
+  ntp_stats.offset_ms = offset / 1000;
+  ntp_stats.rtt_ms = (uint32_t)(delay > 0 ? delay / 1000 : 0);
+  ntp_stats.server = ntp.server;
+  ntp_stats.synced_at = millis();
+  ntp_stats.count++;
+  time_synced = true;
+  Serial.printf("✓ Time synced from %s (offset %lldms, rtt %lums)\n", NTP_SERVERS[ntp.server],
+                (long long)ntp_stats.offset_ms, (unsigned long)ntp_stats.rtt_ms);
+  return true;
+}
+
+// Advance the client. Returns true when a sync just completed.
+bool time_sync_poll() {
+  uint32_t now = millis();
+  switch (ntp.state) {
+    case SYNC_WAITING:
+      if (ntp.udp.parsePacket() >= 48 && time_sync_receive()) {
+        ntp.udp.stop();
+        ntp.next_at = now + NTP_RESYNC_MS;
+        ntp.state = SYNC_SLEEPING;
+        return true;
+      }
+      if (now - ntp.sent_at >= NTP_REPLY_TIMEOUT_MS) {
+        if (++ntp.server < NTP_SERVER_COUNT) {
+          time_sync_send();
+        } else {
+          Serial.println("✗ Time sync failed, retrying in 60s");
+          ntp.udp.stop();
+          ntp.next_at = now + NTP_RETRY_MS;
+          ntp.state = SYNC_SLEEPING;
+        }
+      }
+      break;
+
+    case SYNC_SLEEPING:
+      if ((int32_t)(now - ntp.next_at) >= 0 && WiFi.status() == WL_CONNECTED) time_sync_start();
+      break;
+
+    default:
+      break;
+  }
+  return false;
+}
+
+#endif // TIME_SYNC_H
@@ -0,0 +1,293 @@
+// Generated by embed_web.py from web/ - do not edit by hand.
+
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+// source index.html sha256 7ac91b7f93465baf17191b1155209b414cfcfdfb0cdd2d96f94ba7d7e2e3d54c
+// 15543 B raw -> 4459 B gzip
+const char INDEX_HTML_TYPE[] = "text/html";
+const char INDEX_HTML_ETAG[] = "\"0e229282cbc84e05\"";
+const size_t INDEX_HTML_GZ_LEN = 4459;
+const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x3b, 0xdb, 0x8e, 0xdb, 0x48,
+  0x76, 0xef, 0xfd, 0x15, 0x35, 0x1a, 0x0c, 0x48, 0x4d, 0x4b, 0x94, 0xd4, 0xb7, 0xf1, 0x52, 0x2d,
+  0x4d, 0x7c, 0xeb, 0x5d, 0x6f, 0xda, 0x6b, 0x63, 0xd4, 0xde, 0x49, 0x60, 0x18, 0x46, 0x89, 0x2c,
+  0x4a, 0x35, 0x22, 0x59, 0x0c, 0x49, 0x59, 0x2d, 0x6b, 0x3a, 0xd8, 0x87, 0x20, 0x0f, 0x41, 0x92,
+  0x05, 0x32, 0x01, 0x16, 0xbb, 0x08, 0x10, 0x4c, 0x90, 0x04, 0x79, 0xc8, 0x43, 0x1e, 0xf3, 0x94,
+  0x8f, 0xf1, 0x0f, 0x24, 0x9f, 0x90, 0x73, 0xaa, 0x8a, 0x37, 0x49, 0x2d, 0x51, 0xf6, 0x00, 0x41,
+  0xda, 0x80, 0x25, 0x16, 0xeb, 0xdc, 0xaf, 0x75, 0xaa, 0xfb, 0xf2, 0xb3, 0x27, 0x2f, 0x1e, 0xdf,
+  0xfc, 0xe9, 0xcb, 0xa7, 0x64, 0x9a, 0x06, 0xfe, 0xf0, 0xe8, 0x32, 0xfb, 0x60, 0xd4, 0x85, 0x8f,
+  0x80, 0xa5, 0x94, 0x38, 0x53, 0x1a, 0x27, 0x2c, 0x1d, 0x34, 0x5e, 0xdd, 0x5c, 0xb5, 0x1f, 0x34,
+  0xb2, 0xe5, 0x90, 0x06, 0x6c, 0xd0, 0x78, 0xc7, 0xd9, 0x22, 0x12, 0x71, 0xda, 0x20, 0x8e, 0x08,
+  0x53, 0x16, 0xc2, 0xb6, 0x05, 0x77, 0xd3, 0xe9, 0xc0, 0x65, 0xef, 0xb8, 0xc3, 0xda, 0xf2, 0xa1,
+  0xc5, 0x43, 0x9e, 0x72, 0xea, 0xb7, 0x13, 0x87, 0xfa, 0x6c, 0xd0, 0x43, 0x1c, 0x29, 0x4f, 0x7d,
+  0x36, 0xbc, 0xf2, 0x79, 0x44, 0x1e, 0xfb, 0xc2, 0x99, 0x91, 0xc7, 0x22, 0xf4, 0xf8, 0xe4, 0xb2,
+  0xa3, 0x5e, 0x1c, 0x5d, 0x26, 0xe9, 0x12, 0x3f, 0xbf, 0x5c, 0x05, 0x34, 0x9e, 0xf0, 0xd0, 0xee,
+  0xf6, 0x23, 0xea, 0xba, 0x3c, 0x9c, 0xc0, 0xb7, 0xb1, 0xb8, 0x6d, 0x27, 0xfc, 0x3d, 0x3e, 0x8c,
+  0x45, 0xec, 0xb2, 0xb8, 0x0d, 0x2b, 0x77, 0x47, 0x63, 0xe1, 0x2e, 0x57, 0x1e, 0xf0, 0xd1, 0xf6,
+  0x68, 0xc0, 0xfd, 0xa5, 0xdd, 0xa6, 0x51, 0xe4, 0xb3, 0x76, 0xb2, 0x4c, 0x52, 0x16, 0xb4, 0x1e,
+  0xf9, 0x3c, 0x9c, 0x3d, 0xa7, 0xce, 0x48, 0x3e, 0x5e, 0xc1, 0xbe, 0x96, 0x31, 0x62, 0x13, 0xc1,
+  0xc8, 0xab, 0x67, 0x46, 0xeb, 0x1b, 0x31, 0x16, 0xa9, 0x68, 0x25, 0x34, 0x4c, 0xda, 0x09, 0x8b,
+  0xb9, 0xd7, 0x1f, 0x53, 0x67, 0x36, 0x89, 0xc5, 0x3c, 0x74, 0xed, 0xcf, 0xbb, 0x14, 0xff, 0xf5,
+  0x1d, 0xe1, 0x8b, 0xd8, 0xfe, 0x9c, 0x75, 0xf1, 0x5f, 0xce, 0xd0, 0x49, 0x37, 0x02, 0xea, 0x16,
+  0x6a, 0x80, 0xf2, 0x90, 0xc5, 0xc0, 0xf2, 0xad, 0x92, 0xdc, 0x7e, 0xd0, 0x85, 0x77, 0xfd, 0x4c,
+  0x04, 0x42, 0xe7, 0xa9, 0xb8, 0x3b, 0x9a, 0xf6, 0x56, 0x1a, 0x91, 0xe7, 0x9d, 0xc2, 0x8f, 0x7e,
+  0x0f, 0x42, 0xa4, 0xa9, 0x08, 0xec, 0x1e, 0x82, 0x48, 0x31, 0x40, 0x46, 0x66, 0x9f, 0x3c, 0x40,
+  0xec, 0xd3, 0x93, 0x02, 0xe6, 0x02, 0x7e, 0x32, 0x9c, 0x27, 0xe7, 0xd1, 0x2d, 0xe9, 0x92, 0xde,
+  0x49, 0x05, 0xa6, 0x07, 0x30, 0xfd, 0x5c, 0x35, 0x0a, 0x2b, 0xec, 0x4b, 0x84, 0xcf, 0x5d, 0xf2,
+  0x39, 0x92, 0xd4, 0xbc, 0x67, 0x6f, 0x2f, 0xa4, 0x04, 0xc9, 0x7c, 0x2c, 0xd5, 0x9f, 0x91, 0x7a,
+  0xf0, 0xe0, 0xc1, 0x1a, 0x6f, 0x48, 0xae, 0x4c, 0xe7, 0x4c, 0xc1, 0xa5, 0x34, 0x9d, 0x27, 0xed,
+  0x49, 0xcc, 0xdd, 0x95, 0xcb, 0x93, 0xc8, 0xa7, 0x4b, 0x1b, 0x1f, 0xfa, 0xf8, 0x5f, 0x1b, 0x94,
+  0x0d, 0x2b, 0x29, 0x6b, 0x03, 0xd6, 0x79, 0x10, 0x26, 0x76, 0xcc, 0x22, 0x46, 0x53, 0x13, 0x95,
+  0xd1, 0xf6, 0x78, 0xda, 0x0a, 0x78, 0x08, 0x1a, 0x33, 0x7b, 0xe7, 0x20, 0x78, 0xab, 0xe7, 0xc5,
+  0xcd, 0x66, 0x7f, 0x42, 0x23, 0x5b, 0xca, 0xb4, 0x49, 0xbe, 0xa0, 0xe7, 0xd0, 0xd8, 0x5d, 0x95,
+  0xad, 0xd4, 0xa3, 0xf8, 0x4f, 0x0b, 0xbe, 0x2e, 0xb1, 0x56, 0x47, 0x4c, 0x5d, 0x3e, 0x4f, 0x50,
+  0xe0, 0xdc, 0x7e, 0x48, 0xa8, 0xc0, 0xea, 0xd3, 0x31, 0xf3, 0xcb, 0x1a, 0x28, 0x89, 0xdb, 0xdb,
+  0xe0, 0xa8, 0xa2, 0x80, 0x77, 0xd4, 0x9f, 0xb3, 0xc2, 0x4e, 0xde, 0xba, 0x45, 0xe4, 0xe3, 0x82,
+  0xf1, 0xc9, 0x34, 0xb5, 0x2f, 0xba, 0x5d, 0x00, 0xf4, 0x44, 0x1c, 0xb4, 0x91, 0xfd, 0x68, 0xb5,
+  0xe6, 0x04, 0xd2, 0x22, 0x8a, 0x97, 0x4c, 0xa5, 0x63, 0x0c, 0x94, 0xcc, 0x07, 0x29, 0xa5, 0x9b,
+  0xac, 0x94, 0x09, 0x9e, 0x22, 0x02, 0x1e, 0x46, 0xf3, 0xf4, 0x75, 0xba, 0x8c, 0x20, 0x56, 0x53,
+  0x76, 0x9b, 0x36, 0xde, 0xb4, 0xca, 0x4b, 0x11, 0x4d, 0x92, 0x05, 0xe8, 0x65, 0x6d, 0x39, 0x9c,
+  0x07, 0x63, 0x16, 0xc3, 0x62, 0xc2, 0x7c, 0xe6, 0xa4, 0x2b, 0xe5, 0xcb, 0xbd, 0x6e, 0xf7, 0x8b,
+  0x5c, 0x67, 0xd2, 0xc1, 0x3e, 0x4e, 0xf5, 0xc8, 0xe7, 0x76, 0x1d, 0x6d, 0xb0, 0x1c, 0xd3, 0x70,
+  0xc2, 0x1a, 0x6f, 0xca, 0x0c, 0x4c, 0x95, 0xfa, 0xce, 0xd7, 0xe8, 0x6f, 0x92, 0xd9, 0x40, 0xe6,
+  0x4c, 0x99, 0x33, 0x83, 0x44, 0x51, 0xe0, 0x43, 0x21, 0x34, 0x3e, 0xf9, 0x5d, 0xeb, 0x33, 0x96,
+  0x2b, 0xb8, 0xf0, 0x8e, 0xc5, 0x29, 0x87, 0xa4, 0xd5, 0xa6, 0x3e, 0x9f, 0x84, 0x76, 0xc0, 0x5d,
+  0xd7, 0x67, 0x68, 0x6f, 0x10, 0x0d, 0x28, 0x81, 0xbd, 0x73, 0xe3, 0xf0, 0x10, 0xd2, 0x0b, 0x6b,
+  0x2b, 0x1b, 0x95, 0x39, 0xd3, 0x31, 0x5e, 0x92, 0x38, 0xcf, 0x1b, 0xa0, 0xa5, 0x8b, 0x22, 0x50,
+  0x0b, 0xbe, 0xef, 0x71, 0x39, 0x9f, 0x79, 0x8a, 0x2d, 0x08, 0x18, 0x9d, 0x5f, 0x4e, 0x51, 0x0f,
+  0x68, 0x58, 0xcd, 0xa1, 0x03, 0x29, 0x98, 0xc5, 0x90, 0x0a, 0xe7, 0xe0, 0x12, 0xe1, 0x6a, 0x37,
+  0x1f, 0xda, 0x58, 0xa1, 0x08, 0x59, 0x11, 0x0b, 0x10, 0x83, 0x04, 0x13, 0xda, 0x16, 0xa3, 0x55,
+  0xe3, 0xbe, 0xef, 0xcc, 0xe3, 0x04, 0x50, 0x45, 0x82, 0x23, 0xcd, 0x4d, 0xe5, 0x55, 0xbd, 0x53,
+  0x66, 0x31, 0xc5, 0x96, 0x3d, 0x15, 0xa0, 0xd8, 0x35, 0xe6, 0xce, 0xe1, 0x27, 0xdb, 0x60, 0x25,
+  0xcc, 0x59, 0xad, 0x59, 0xb7, 0xfc, 0x6e, 0x0b, 0x82, 0xb3, 0xb3, 0x33, 0x99, 0x82, 0x41, 0xb8,
+  0x43, 0xf3, 0xd0, 0xb9, 0xcc, 0x39, 0x32, 0xe5, 0x94, 0xd8, 0x4e, 0x45, 0xa4, 0x78, 0xd6, 0x48,
+  0x45, 0x94, 0x6e, 0x71, 0xc3, 0xb3, 0x42, 0x53, 0xd2, 0x9c, 0xbb, 0x9d, 0xbe, 0xa2, 0xb0, 0x32,
+  0x66, 0x10, 0xca, 0x5f, 0x69, 0x80, 0x6a, 0x69, 0xd0, 0x8b, 0xda, 0xda, 0x92, 0x9f, 0x20, 0x99,
+  0xac, 0x4a, 0x4c, 0xf6, 0xce, 0xcb, 0xa9, 0x6c, 0xaf, 0xe5, 0x72, 0x1c, 0x96, 0x98, 0x55, 0x93,
+  0xe7, 0xf8, 0x9c, 0x9d, 0x74, 0x33, 0xff, 0x38, 0x73, 0xa8, 0x77, 0xde, 0xd5, 0x3b, 0x59, 0x5c,
+  0x55, 0xf6, 0xf8, 0xab, 0x9e, 0xd3, 0x73, 0x72, 0x57, 0x3a, 0x3b, 0x3b, 0x3d, 0xbd, 0xb8, 0x3b,
+  0x4a, 0x02, 0xea, 0xe7, 0x89, 0x13, 0x4b, 0x54, 0xd5, 0x8b, 0xef, 0x8e, 0xfe, 0x28, 0x60, 0x2e,
+  0xa7, 0x66, 0x51, 0x1d, 0x2f, 0xb0, 0x3a, 0x36, 0x57, 0xb2, 0x6e, 0x97, 0x25, 0xb8, 0x83, 0x0a,
+  0x59, 0x2a, 0x80, 0x98, 0x9e, 0x2b, 0x35, 0x66, 0xbb, 0x39, 0xc1, 0x8a, 0x77, 0x77, 0x47, 0x97,
+  0x1d, 0xdd, 0x39, 0x5c, 0x76, 0x74, 0x17, 0x83, 0xe8, 0xe1, 0xc3, 0xe5, 0xef, 0x88, 0xe3, 0x43,
+  0xc2, 0x83, 0x4c, 0x90, 0x55, 0x6a, 0xec, 0x44, 0xa6, 0xbd, 0xe1, 0x87, 0xdf, 0xfe, 0x07, 0x29,
+  0x5a, 0x11, 0x00, 0xec, 0xc1, 0x7a, 0x94, 0xed, 0xce, 0xaa, 0x62, 0x63, 0xa8, 0x7a, 0x94, 0x79,
+  0x4c, 0x53, 0x2e, 0x42, 0xf2, 0x0c, 0xad, 0xe8, 0x51, 0x87, 0x91, 0x0f, 0xbf, 0xf9, 0x27, 0xf2,
+  0x72, 0x4a, 0x13, 0x46, 0x4e, 0x2e, 0x3b, 0xd1, 0xf0, 0x08, 0x90, 0x9e, 0x0c, 0xff, 0xe7, 0x1f,
+  0x7f, 0xf8, 0x2b, 0x32, 0x92, 0x5c, 0x03, 0xc6, 0x93, 0x2a, 0x07, 0x25, 0x69, 0x80, 0x07, 0x42,
+  0xb6, 0xbc, 0xc3, 0xea, 0xd6, 0x18, 0x6e, 0x79, 0x21, 0x8b, 0x42, 0x63, 0x78, 0xc3, 0x03, 0x76,
+  0xd9, 0x81, 0xd7, 0xdb, 0xf6, 0xc8, 0x4a, 0xd4, 0x20, 0xdc, 0x85, 0xb4, 0x0f, 0xfb, 0x1a, 0xc3,
+  0x76, 0xdb, 0x6e, 0xb7, 0xf5, 0x76, 0xf9, 0xff, 0xc7, 0x11, 0x7d, 0x44, 0x53, 0x10, 0x7a, 0x59,
+  0x87, 0xee, 0x18, 0xb6, 0x22, 0xdd, 0x2f, 0x3e, 0x9d, 0xea, 0xb7, 0xfc, 0x8a, 0xd7, 0x21, 0xb9,
+  0xe0, 0x1e, 0x47, 0x92, 0x9f, 0x4e, 0xf1, 0x55, 0x94, 0xd6, 0x54, 0xef, 0x3c, 0xda, 0xa0, 0xa8,
+  0x3f, 0xb4, 0x17, 0xfc, 0xed, 0xbf, 0x91, 0x27, 0x2a, 0x17, 0x6d, 0xba, 0x41, 0x51, 0xfe, 0x95,
+  0x17, 0x48, 0xea, 0xc3, 0x4b, 0x59, 0xb5, 0xc8, 0x5a, 0xd5, 0x92, 0xd4, 0x92, 0xa9, 0x58, 0xbc,
+  0x85, 0x0c, 0xd8, 0x18, 0x92, 0x11, 0x7c, 0x25, 0xf0, 0x55, 0x84, 0x2e, 0x38, 0x98, 0x82, 0xcc,
+  0x48, 0x7f, 0x3a, 0x0d, 0x17, 0x22, 0x2b, 0x23, 0x82, 0xdf, 0x0f, 0xa7, 0xf0, 0x18, 0x13, 0x01,
+  0x19, 0x01, 0xee, 0xa0, 0x80, 0xae, 0x1a, 0xa3, 0x48, 0xd7, 0x12, 0x70, 0xdb, 0x4b, 0x48, 0x8e,
+  0x0d, 0x22, 0x23, 0x1a, 0x3d, 0x6a, 0xbd, 0x9a, 0x35, 0x90, 0x37, 0xda, 0x76, 0x06, 0x8d, 0x6e,
+  0xa3, 0xb0, 0xf7, 0x21, 0x78, 0x4e, 0x4f, 0x11, 0x53, 0x81, 0xa7, 0xf7, 0xd1, 0x78, 0x10, 0x53,
+  0x81, 0xe7, 0xe4, 0x23, 0xf1, 0x78, 0xf2, 0xa7, 0xc0, 0x73, 0xfa, 0xd1, 0x78, 0x28, 0xed, 0x76,
+  0x0b, 0x3c, 0x67, 0x25, 0x3c, 0xeb, 0x6e, 0xba, 0xdf, 0x94, 0xf2, 0x84, 0x76, 0x05, 0xa9, 0xae,
+  0x6c, 0x48, 0xd5, 0x1c, 0x4a, 0x97, 0xc1, 0x2c, 0x98, 0x99, 0x10, 0x38, 0xc2, 0xec, 0x28, 0x43,
+  0x44, 0xda, 0xe5, 0xc9, 0xa8, 0xfd, 0x84, 0x4f, 0x78, 0x4a, 0x7d, 0x82, 0x49, 0xfd, 0xb2, 0xa3,
+  0x76, 0x6c, 0xdd, 0x0e, 0xea, 0xff, 0x35, 0x20, 0x05, 0xc7, 0xf9, 0x0a, 0x4e, 0x61, 0x93, 0x80,
+  0x55, 0xf7, 0x43, 0x72, 0x97, 0x44, 0x0f, 0x70, 0xc3, 0x91, 0xc2, 0x42, 0x92, 0x19, 0x5b, 0x10,
+  0x33, 0xc7, 0x4a, 0x90, 0xe5, 0x26, 0x08, 0x11, 0xd1, 0x30, 0x0f, 0xee, 0xbc, 0xab, 0xd3, 0x81,
+  0x00, 0x20, 0x6f, 0xdf, 0x35, 0x86, 0x17, 0x40, 0x16, 0xb6, 0x0d, 0xcb, 0xc2, 0x97, 0xc3, 0x47,
+  0x75, 0xa9, 0x39, 0x48, 0x83, 0x40, 0x7f, 0x86, 0x92, 0x13, 0xa8, 0x74, 0xe0, 0x09, 0xf0, 0x45,
+  0x4b, 0x77, 0xd1, 0x58, 0x4f, 0x0e, 0x7f, 0xf7, 0x23, 0x79, 0x24, 0x3b, 0xa6, 0x90, 0x25, 0xc9,
+  0x4f, 0x90, 0x1f, 0xf0, 0x4c, 0xf5, 0x76, 0x0c, 0x75, 0x8d, 0x3c, 0xc4, 0xd3, 0xd5, 0x38, 0xc7,
+  0x4d, 0xcc, 0x64, 0x1e, 0xc6, 0x3c, 0x61, 0x1d, 0xf8, 0x84, 0xe3, 0x7c, 0xf3, 0xf0, 0x80, 0x7e,
+  0x42, 0x97, 0xbb, 0xf5, 0xe5, 0xd2, 0x25, 0xaa, 0xeb, 0xa4, 0xdb, 0xad, 0xaf, 0x30, 0x84, 0x01,
+  0x7e, 0x95, 0xca, 0xce, 0x73, 0x9d, 0x9d, 0x9f, 0xe7, 0x4a, 0x03, 0x74, 0x8d, 0x03, 0xb8, 0xfc,
+  0x15, 0x4a, 0xbc, 0x9b, 0xcf, 0x10, 0xb7, 0x20, 0xa7, 0x67, 0x07, 0x30, 0xaa, 0x80, 0x72, 0x56,
+  0x7b, 0x19, 0xab, 0xbd, 0xf3, 0xc2, 0xbe, 0x67, 0x07, 0x71, 0x7a, 0x03, 0xd8, 0x13, 0x2e, 0xbd,
+  0xdf, 0x04, 0x9c, 0xf3, 0x94, 0x25, 0x7b, 0x1c, 0x32, 0x45, 0x08, 0x64, 0xfc, 0xf4, 0x00, 0xc6,
+  0x25, 0x50, 0xa6, 0x60, 0xcd, 0xf4, 0x45, 0xc1, 0xf3, 0xe9, 0x41, 0x3c, 0x5f, 0x51, 0x97, 0x11,
+  0x60, 0x38, 0x15, 0x73, 0x67, 0x0a, 0x6c, 0x27, 0xcd, 0xfb, 0x38, 0xd0, 0x67, 0x48, 0x9d, 0x1e,
+  0x5c, 0xf6, 0x56, 0x82, 0xac, 0xc5, 0x06, 0xb4, 0xd2, 0x98, 0xa4, 0x92, 0x94, 0x45, 0xca, 0xfa,
+  0xb9, 0x22, 0xbb, 0x8d, 0xf5, 0x1c, 0xc3, 0xa0, 0xbf, 0xd2, 0x48, 0x86, 0x9b, 0x49, 0xe6, 0x1a,
+  0xda, 0x39, 0x1a, 0xe7, 0xb9, 0x62, 0x33, 0xad, 0x3c, 0xc5, 0xf6, 0x0c, 0x5a, 0x66, 0x31, 0x4f,
+  0xef, 0xdb, 0x75, 0xa2, 0x77, 0x55, 0xb6, 0x1c, 0x9e, 0x71, 0x32, 0x1d, 0x41, 0x94, 0xa5, 0xd0,
+  0xd1, 0x26, 0x38, 0x41, 0x03, 0x6b, 0x1c, 0xa6, 0x2d, 0xc7, 0x9b, 0xd4, 0xd4, 0xd5, 0x83, 0xfb,
+  0x74, 0x85, 0x28, 0xfe, 0x1f, 0x68, 0x8a, 0x42, 0x6e, 0xae, 0xa4, 0x26, 0x29, 0x62, 0x72, 0x98,
+  0xba, 0x30, 0xef, 0xd5, 0xd4, 0xd7, 0x49, 0xf7, 0x3e, 0x85, 0x49, 0x24, 0xff, 0x97, 0x1a, 0xd3,
+  0x45, 0xe1, 0xaf, 0x7f, 0x4f, 0x54, 0x16, 0x1b, 0xf9, 0x8c, 0x45, 0x75, 0xab, 0x82, 0xdc, 0x4c,
+  0x16, 0x3c, 0x74, 0xc5, 0xe2, 0x9e, 0x32, 0x9d, 0xe0, 0x96, 0xb7, 0x81, 0x70, 0xef, 0x2f, 0xd6,
+  0x2f, 0x3c, 0x6f, 0x5f, 0x81, 0xbe, 0xe2, 0xb7, 0xcc, 0x25, 0xd8, 0x1f, 0x27, 0x3b, 0xb7, 0x82,
+  0xc8, 0x23, 0x65, 0xd0, 0x54, 0x64, 0x26, 0xde, 0x5e, 0xcc, 0x91, 0x4b, 0x3c, 0x3c, 0x0e, 0x47,
+  0x4e, 0xcc, 0x58, 0x48, 0x84, 0xe7, 0x11, 0x1a, 0xba, 0xc4, 0x45, 0x89, 0x24, 0xd3, 0x7d, 0x92,
+  0xd2, 0x88, 0xa4, 0x53, 0x46, 0x12, 0xb5, 0x05, 0x51, 0x32, 0x26, 0x57, 0x54, 0xa7, 0xae, 0x10,
+  0x1c, 0xe0, 0x7b, 0xb1, 0x08, 0x48, 0x87, 0xcc, 0xc3, 0x94, 0xfb, 0xc4, 0xf4, 0x0a, 0x99, 0xee,
+  0x75, 0x3a, 0x79, 0x90, 0x2a, 0xe9, 0x11, 0xce, 0x02, 0x38, 0xf8, 0xce, 0xa4, 0x3d, 0xb5, 0x33,
+  0xbf, 0xda, 0x05, 0xc4, 0x42, 0x37, 0x07, 0xe9, 0x5e, 0xd8, 0xe5, 0xda, 0x96, 0x59, 0xff, 0x6f,
+  0xc8, 0xb5, 0x70, 0xe4, 0x11, 0xb3, 0xae, 0xe9, 0xaf, 0x61, 0x77, 0x3a, 0x77, 0x59, 0x9d, 0x70,
+  0x81, 0x23, 0x73, 0x16, 0x14, 0x5d, 0x0b, 0x42, 0xa1, 0x57, 0x54, 0x82, 0x9f, 0x59, 0x5f, 0x9d,
+  0x43, 0xe1, 0x2d, 0xd9, 0xe3, 0xf1, 0x3c, 0x8e, 0x65, 0xf3, 0xa4, 0xac, 0x67, 0xeb, 0xf2, 0x84,
+  0x78, 0xf0, 0x39, 0x3f, 0x56, 0xca, 0x5a, 0xd4, 0x22, 0x2a, 0x7e, 0xcb, 0xbb, 0xe0, 0xb1, 0xba,
+  0xe9, 0x70, 0x43, 0x5d, 0x8b, 0x70, 0x52, 0x5f, 0x3a, 0x11, 0xde, 0x23, 0x5d, 0xbb, 0xd7, 0xfb,
+  0x99, 0xf5, 0xa0, 0x77, 0x7a, 0x7e, 0x50, 0x89, 0x06, 0xeb, 0xbd, 0x17, 0xe1, 0xbd, 0xa4, 0xe5,
+  0x48, 0x55, 0x55, 0xd9, 0xf7, 0x39, 0xa5, 0x97, 0xa3, 0x9b, 0x07, 0x2f, 0x9f, 0xdc, 0xb4, 0x9e,
+  0x9f, 0x5a, 0x27, 0x56, 0xb7, 0x73, 0xd2, 0x7a, 0xde, 0xeb, 0x59, 0x3d, 0xfc, 0xb6, 0x61, 0xeb,
+  0x1f, 0x7e, 0x24, 0xea, 0x6c, 0x5b, 0x33, 0xc4, 0x47, 0xcf, 0x9e, 0xec, 0x67, 0x25, 0x49, 0xe4,
+  0x79, 0xaa, 0xb6, 0x90, 0x2f, 0xf5, 0x10, 0xf8, 0x3e, 0xcc, 0xf9, 0x90, 0x58, 0x62, 0xc7, 0xa7,
+  0xb2, 0x8b, 0x5c, 0x33, 0xfa, 0x8e, 0x91, 0xb1, 0x4f, 0xc3, 0x19, 0x06, 0xe5, 0x0c, 0x43, 0xd6,
+  0xd1, 0x6e, 0x13, 0xe5, 0x98, 0xab, 0x46, 0xcf, 0x3c, 0xfd, 0x9f, 0xff, 0xfb, 0x3f, 0x7f, 0x4b,
+  0xbe, 0x65, 0x14, 0xa2, 0x38, 0x26, 0xe6, 0x0b, 0x99, 0x19, 0xa8, 0xdf, 0xfc, 0x09, 0xfa, 0xe0,
+  0x45, 0x3a, 0x8d, 0x21, 0xd6, 0xa0, 0x0f, 0x7e, 0x1a, 0xd2, 0xb1, 0xcf, 0xc8, 0x42, 0x51, 0x39,
+  0xbc, 0xeb, 0x7d, 0x11, 0xb1, 0x50, 0xb3, 0xf8, 0x1c, 0x52, 0xd0, 0xc3, 0x97, 0xcf, 0xc8, 0x1f,
+  0xb3, 0xe5, 0x7e, 0x2b, 0x48, 0x0e, 0x66, 0x6c, 0xd9, 0x20, 0x70, 0xf4, 0x77, 0xd8, 0x54, 0xf8,
+  0xd0, 0xca, 0x0d, 0x1a, 0x3f, 0x87, 0x74, 0xe8, 0x41, 0x06, 0x03, 0x45, 0x2d, 0xb1, 0xf4, 0x09,
+  0x40, 0xaf, 0x79, 0x0b, 0x68, 0x64, 0x89, 0x78, 0x52, 0x56, 0xee, 0x15, 0xec, 0xb4, 0xc9, 0x45,
+  0x97, 0x38, 0xf0, 0x94, 0x74, 0xa0, 0xbe, 0xb5, 0x08, 0xd6, 0xb5, 0x8e, 0x8b, 0xd3, 0x84, 0x2d,
+  0x4a, 0xfd, 0xf0, 0xef, 0x7f, 0x89, 0x3a, 0xbd, 0xe2, 0x71, 0xb0, 0xa0, 0x31, 0xab, 0xab, 0xc9,
+  0x6c, 0x3f, 0xe1, 0x01, 0xc5, 0x4e, 0xc5, 0x8a, 0xb8, 0xe8, 0x8c, 0xe7, 0xdc, 0x77, 0x3b, 0x1f,
+  0x7e, 0xf3, 0xaf, 0x1d, 0x4f, 0xbf, 0xb6, 0xc6, 0x3c, 0xbc, 0x37, 0x3d, 0x7a, 0xdc, 0xd7, 0x99,
+  0xce, 0x83, 0x23, 0x10, 0x75, 0x1c, 0x16, 0xa5, 0x83, 0x06, 0x82, 0x1c, 0xe2, 0x8c, 0xa3, 0x5f,
+  0x3c, 0x6c, 0x9f, 0x9c, 0x5f, 0xc0, 0x71, 0x65, 0x4a, 0xe1, 0x33, 0x99, 0x07, 0xa4, 0x16, 0xf5,
+  0x42, 0xf1, 0xde, 0xe2, 0x2d, 0xc0, 0xae, 0xa9, 0xfd, 0x8a, 0xfb, 0x3e, 0x24, 0x78, 0x1e, 0xca,
+  0x2b, 0xb8, 0x80, 0xca, 0xa9, 0xbe, 0xbf, 0x24, 0x8b, 0x29, 0xd6, 0x12, 0x28, 0x22, 0xe3, 0x58,
+  0x2c, 0x12, 0xf0, 0x42, 0x87, 0x1e, 0xc4, 0xee, 0x8b, 0x9b, 0x87, 0xe0, 0xf5, 0x33, 0x16, 0xd6,
+  0x0b, 0x1e, 0xe0, 0x4d, 0xee, 0x5e, 0xe3, 0xee, 0x65, 0x8c, 0x13, 0x61, 0x57, 0x36, 0xd6, 0x58,
+  0xe2, 0x58, 0xcc, 0xe1, 0xb0, 0xec, 0x88, 0x30, 0x11, 0xbe, 0x6c, 0x90, 0xc6, 0x42, 0xa4, 0x25,
+  0xb6, 0xd4, 0x24, 0x1c, 0xb6, 0x3b, 0x3e, 0x77, 0x66, 0x38, 0x83, 0xf2, 0x05, 0x75, 0xcd, 0x66,
+  0x23, 0xb3, 0xff, 0xab, 0x08, 0x67, 0x36, 0x25, 0x37, 0x50, 0x10, 0x5a, 0x22, 0xcd, 0x49, 0x90,
+  0x4c, 0xf2, 0xa1, 0x80, 0x72, 0x9e, 0x3f, 0xfc, 0x1e, 0x81, 0x1f, 0x3a, 0x18, 0x87, 0xd9, 0x69,
+  0x74, 0x9d, 0x56, 0x02, 0xe1, 0x8e, 0x94, 0xe0, 0xec, 0xfa, 0x5f, 0x64, 0x84, 0xb1, 0x9f, 0xdd,
+  0xdc, 0xe6, 0x34, 0x34, 0x48, 0x76, 0x88, 0x61, 0x4e, 0xa3, 0x00, 0x8f, 0x99, 0x2c, 0x9b, 0x0a,
+  0xc3, 0xdf, 0xff, 0x05, 0xf9, 0x46, 0x3d, 0xd7, 0x84, 0x66, 0xb7, 0x78, 0xd9, 0xfc, 0xd8, 0x9b,
+  0x28, 0xf8, 0x1f, 0xfe, 0x85, 0x3c, 0x95, 0x2b, 0x5b, 0x04, 0xac, 0x4a, 0x97, 0x7d, 0x42, 0xf7,
+  0xc0, 0x23, 0xe8, 0x38, 0x50, 0xb7, 0xd8, 0x68, 0x0e, 0x56, 0x77, 0xfd, 0x23, 0xc9, 0xc1, 0xd3,
+  0x77, 0x90, 0xb1, 0x12, 0xb3, 0xd9, 0x3f, 0x42, 0x5d, 0x4a, 0x12, 0xfd, 0xa3, 0x23, 0x57, 0x38,
+  0x73, 0x1c, 0x17, 0x58, 0x13, 0x96, 0x3e, 0xf5, 0x19, 0x7e, 0x7d, 0xb4, 0x7c, 0xe6, 0x9a, 0x86,
+  0x3a, 0xb7, 0x1a, 0x4d, 0x4b, 0x84, 0xd2, 0xdc, 0x03, 0x6f, 0x1e, 0x4a, 0xbd, 0x99, 0xcd, 0xd5,
+  0x4e, 0xa0, 0x77, 0x00, 0x83, 0xce, 0xfa, 0x58, 0xdf, 0x97, 0xa7, 0x53, 0x9e, 0x58, 0xb2, 0x72,
+  0x00, 0x27, 0xf7, 0x42, 0x66, 0xa7, 0xcf, 0x03, 0x09, 0xea, 0x93, 0xee, 0x47, 0x91, 0x94, 0xe7,
+  0xc6, 0x03, 0xe9, 0xe9, 0x03, 0xea, 0x47, 0xd1, 0xc3, 0xd1, 0xc9, 0x81, 0xe4, 0xd4, 0x80, 0x66,
+  0x17, 0xb5, 0x82, 0xdc, 0x9f, 0xcd, 0x59, 0xbc, 0x1c, 0xc9, 0x86, 0x53, 0xc4, 0x0f, 0x7d, 0xdf,
+  0x34, 0x8a, 0xeb, 0x17, 0xc0, 0x00, 0xe1, 0xfd, 0x94, 0x3a, 0x53, 0x93, 0x0d, 0x86, 0x2b, 0x88,
+  0x61, 0x66, 0x65, 0x3e, 0x57, 0xe2, 0x43, 0x36, 0xb9, 0x87, 0x22, 0xbc, 0x1d, 0x0c, 0x6f, 0x2d,
+  0xe9, 0xcc, 0xd7, 0x3c, 0x49, 0xad, 0x98, 0x05, 0x02, 0x02, 0xc8, 0x80, 0xd6, 0xd7, 0x68, 0x82,
+  0x87, 0x21, 0x4a, 0xc9, 0x71, 0xb1, 0x85, 0xba, 0xae, 0x7e, 0x8f, 0xaf, 0x41, 0x88, 0x3b, 0xf4,
+  0xc4, 0x4e, 0x87, 0x5c, 0x73, 0x88, 0x36, 0x35, 0x81, 0x26, 0x3c, 0x21, 0xd1, 0x3c, 0x99, 0x42,
+  0xd2, 0x18, 0x2f, 0x65, 0xd2, 0x70, 0xe4, 0x8c, 0xce, 0x14, 0x21, 0x64, 0x35, 0x75, 0xe0, 0x74,
+  0x21, 0x73, 0x32, 0xdf, 0x4d, 0x9a, 0x7d, 0xe2, 0x41, 0xb2, 0x23, 0x38, 0x1e, 0x84, 0x64, 0x85,
+  0x98, 0x22, 0xe1, 0xfb, 0x70, 0x34, 0x25, 0xdc, 0xab, 0x24, 0x3f, 0x11, 0x13, 0x4a, 0xa2, 0x58,
+  0xdc, 0x2e, 0x31, 0x0f, 0x86, 0x22, 0x55, 0xe5, 0x5c, 0xe6, 0xa4, 0x34, 0x66, 0x34, 0x90, 0xe5,
+  0xea, 0x28, 0x53, 0x09, 0xa9, 0x04, 0x0e, 0xaa, 0x87, 0x7b, 0xe6, 0x67, 0xea, 0x04, 0x62, 0xc9,
+  0xe5, 0x91, 0x98, 0xc7, 0x0e, 0x6b, 0xae, 0xa0, 0x0d, 0x94, 0xb7, 0x25, 0x60, 0x16, 0x73, 0x2e,
+  0x73, 0x93, 0xba, 0x18, 0x69, 0xe1, 0x61, 0xac, 0xd9, 0x2f, 0x2f, 0x41, 0xd8, 0xc5, 0x2c, 0x9d,
+  0xc7, 0x61, 0xff, 0x0e, 0x10, 0xaa, 0x38, 0x65, 0xc9, 0x20, 0x64, 0x0b, 0x52, 0x42, 0x69, 0x1a,
+  0x1d, 0x1a, 0xf1, 0x0e, 0x93, 0xb4, 0x95, 0xa2, 0x58, 0x02, 0x36, 0x83, 0xfe, 0x3d, 0x81, 0x0a,
+  0x56, 0x58, 0x0d, 0x89, 0x4f, 0xc5, 0x42, 0xe3, 0xfe, 0xe5, 0xe8, 0xc5, 0xaf, 0xac, 0x08, 0x7f,
+  0x9f, 0xc5, 0x64, 0x16, 0x8e, 0x46, 0xc1, 0x04, 0x77, 0x1a, 0x18, 0xd4, 0x2e, 0x09, 0xa0, 0x0d,
+  0x58, 0xc8, 0x62, 0xd3, 0x10, 0x29, 0x35, 0x5a, 0x65, 0x4c, 0xd2, 0x5a, 0x8a, 0x25, 0x77, 0xb0,
+  0x89, 0xab, 0x5f, 0x7a, 0x1f, 0x39, 0xe9, 0xc0, 0xb5, 0x52, 0x40, 0xe1, 0x7f, 0xfd, 0x1c, 0xca,
+  0xbb, 0x05, 0xb5, 0xdb, 0x84, 0xd2, 0xdd, 0x92, 0x0f, 0x72, 0x48, 0x6b, 0xba, 0xd6, 0x78, 0x99,
+  0xb2, 0xe4, 0xcb, 0x1e, 0x16, 0x74, 0xb5, 0xb7, 0xd9, 0xb4, 0xbb, 0x65, 0x34, 0x8e, 0x9f, 0x00,
+  0x1a, 0xb4, 0x39, 0x1b, 0x0c, 0x0c, 0x8f, 0x42, 0x8d, 0x75, 0x8d, 0xaf, 0x0d, 0x16, 0xc7, 0x86,
+  0x6d, 0x88, 0x99, 0x51, 0xde, 0x9b, 0xde, 0xa6, 0xdb, 0xf6, 0x7e, 0xf8, 0x87, 0xdf, 0x11, 0xe3,
+  0xd8, 0xc5, 0x4b, 0x3c, 0x11, 0xdb, 0x66, 0xb1, 0xc3, 0x85, 0xc6, 0x56, 0xbe, 0xff, 0x81, 0xfc,
+  0x1a, 0x7f, 0xe1, 0x85, 0x33, 0xb7, 0x45, 0x74, 0x7e, 0x06, 0xe7, 0x00, 0x02, 0xdf, 0xc6, 0x1c,
+  0xbf, 0x01, 0x38, 0x88, 0x73, 0x6c, 0x7c, 0x61, 0x34, 0x8f, 0x0d, 0xd2, 0x96, 0xd8, 0x66, 0xe3,
+  0x28, 0x81, 0x87, 0xd9, 0x98, 0xa7, 0x9d, 0x44, 0xb3, 0x71, 0x6f, 0x9c, 0xaa, 0x62, 0x03, 0x41,
+  0xc1, 0x43, 0x50, 0xec, 0x2f, 0x6e, 0x9e, 0x5f, 0x0f, 0x8c, 0x72, 0x6d, 0x85, 0x97, 0x80, 0x14,
+  0x64, 0x3d, 0x36, 0x1a, 0x43, 0xe3, 0x18, 0x04, 0x39, 0x36, 0x54, 0xca, 0x96, 0x98, 0xd1, 0xff,
+  0xef, 0x8e, 0x8e, 0x68, 0xb2, 0x0c, 0x1d, 0x92, 0x3b, 0x5f, 0xd5, 0x69, 0xd0, 0x36, 0x69, 0xbc,
+  0x2c, 0x9b, 0x28, 0x1e, 0xd0, 0x05, 0xe5, 0xd0, 0x6e, 0xb1, 0x14, 0xe2, 0x50, 0x39, 0x8c, 0x8a,
+  0x1e, 0x43, 0x9b, 0xaa, 0xe4, 0x19, 0x6a, 0x6b, 0x6c, 0x7d, 0x97, 0x60, 0xa8, 0xab, 0xc8, 0x83,
+  0x43, 0x18, 0x66, 0x84, 0xe6, 0xea, 0x0e, 0xc9, 0x17, 0x5e, 0x5f, 0x40, 0xb9, 0x92, 0xee, 0x8b,
+  0xf1, 0x77, 0x90, 0x04, 0x2c, 0x10, 0x85, 0x4f, 0x42, 0x33, 0x49, 0x5b, 0xae, 0x84, 0xbf, 0x3f,
+  0x4b, 0xc2, 0xa9, 0x62, 0x2d, 0x69, 0x41, 0xd8, 0xe3, 0xea, 0x4e, 0x30, 0xbc, 0x50, 0xdb, 0x04,
+  0xc3, 0xd5, 0x63, 0x20, 0x6a, 0x39, 0xd3, 0x78, 0xf2, 0xb5, 0x41, 0x3e, 0xfc, 0xe1, 0x47, 0xb0,
+  0x9c, 0xb1, 0x9b, 0x03, 0xbc, 0x28, 0xdb, 0x44, 0x15, 0x83, 0x00, 0x60, 0x53, 0xf7, 0x51, 0x60,
+  0xec, 0x84, 0x9e, 0x47, 0x9b, 0xb0, 0xf3, 0x68, 0x27, 0x08, 0x9e, 0x16, 0xb7, 0x10, 0x84, 0xd5,
+  0x9d, 0x60, 0x90, 0x37, 0x36, 0xa1, 0x60, 0x71, 0x9b, 0x3f, 0xe4, 0x65, 0xbb, 0xa6, 0x2b, 0x38,
+  0xb2, 0x6d, 0x31, 0x2a, 0x51, 0xeb, 0x0c, 0xaa, 0x7e, 0xb0, 0xc7, 0xaf, 0xb3, 0xdb, 0x38, 0xe0,
+  0x51, 0x1e, 0x3f, 0x98, 0x3b, 0x70, 0xac, 0x6c, 0xb1, 0x0e, 0x2c, 0x7a, 0xf0, 0x26, 0x30, 0xae,
+  0xee, 0x81, 0xd6, 0x73, 0xfe, 0x0a, 0xac, 0x5e, 0xdb, 0x03, 0x99, 0x37, 0x2e, 0xea, 0xb4, 0xea,
+  0x58, 0x6a, 0x61, 0x0f, 0x54, 0xa9, 0xff, 0xc8, 0xe0, 0xb2, 0xa5, 0x3d, 0x90, 0x59, 0x1b, 0x91,
+  0x81, 0xc9, 0xe7, 0x1a, 0x3c, 0xae, 0x97, 0xf5, 0x83, 0x18, 0xdd, 0x04, 0x3e, 0x84, 0xdb, 0x2d,
+  0xe0, 0x25, 0xae, 0x5f, 0x1b, 0x72, 0x08, 0x6d, 0xb4, 0x0c, 0xc7, 0x9b, 0xc0, 0xff, 0xa8, 0x76,
+  0xe3, 0x4d, 0x5e, 0xef, 0x67, 0xaa, 0x81, 0xd8, 0x9d, 0x0f, 0x71, 0x64, 0x69, 0x1c, 0xcf, 0x72,
+  0xad, 0xbc, 0xce, 0x97, 0xde, 0xf4, 0xf7, 0x01, 0xcb, 0x51, 0x65, 0x15, 0x38, 0x5b, 0xd2, 0xc0,
+  0x77, 0x7b, 0xfd, 0x36, 0x9f, 0x03, 0x96, 0x0c, 0x53, 0x2c, 0xd6, 0x82, 0x96, 0x65, 0x22, 0x07,
+  0x9f, 0x4e, 0x83, 0xc0, 0xcc, 0x70, 0xc8, 0x57, 0xf5, 0x78, 0x60, 0xa1, 0xbb, 0x1d, 0x07, 0xbc,
+  0xd8, 0x87, 0x01, 0x6f, 0xf0, 0x4a, 0xfc, 0xe3, 0xe3, 0x3e, 0x9a, 0xaa, 0xc5, 0xcc, 0x25, 0x86,
+  0xc7, 0x1a, 0x10, 0x5b, 0xdc, 0xa1, 0x06, 0xa4, 0x4f, 0xd3, 0x12, 0x29, 0x78, 0xda, 0xb7, 0x5f,
+  0x84, 0xe5, 0xfd, 0x22, 0xdc, 0xe7, 0xa9, 0xef, 0xcb, 0x41, 0xf5, 0x7e, 0x9f, 0x1c, 0x09, 0x77,
+  0xcb, 0x92, 0xc3, 0xe3, 0x1e, 0x08, 0x3d, 0x41, 0xa9, 0x64, 0x18, 0xbd, 0x56, 0x07, 0x72, 0xc6,
+  0x96, 0x25, 0x7a, 0xd9, 0x52, 0xff, 0x90, 0x16, 0xfa, 0xb5, 0xa3, 0x9e, 0xde, 0xdc, 0xdf, 0x1b,
+  0xe7, 0x15, 0x5a, 0x9f, 0x95, 0x55, 0x93, 0x03, 0x0b, 0xd5, 0x8a, 0x2d, 0x3d, 0x2b, 0x68, 0xae,
+  0x54, 0x63, 0x49, 0x46, 0x29, 0x9c, 0xb7, 0x27, 0xa6, 0xec, 0xc4, 0x3c, 0x5f, 0x00, 0x40, 0xd0,
+  0xb9, 0xe8, 0x36, 0x9b, 0xd0, 0xcd, 0xb9, 0x23, 0x79, 0x3a, 0x3d, 0x69, 0x19, 0x5d, 0x6c, 0x76,
+  0x6c, 0xe3, 0x58, 0x6f, 0x0e, 0xbe, 0x80, 0x1d, 0xeb, 0x1b, 0xee, 0x0a, 0x12, 0xd0, 0xde, 0x25,
+  0x66, 0xaa, 0x18, 0x81, 0xee, 0x6f, 0x00, 0x65, 0x2a, 0xf2, 0x79, 0x6a, 0x02, 0x8a, 0xac, 0xa1,
+  0x25, 0xb2, 0x59, 0x84, 0x3e, 0xd8, 0x8c, 0x5e, 0x77, 0xdf, 0x34, 0xbf, 0xbc, 0xe8, 0x1e, 0x97,
+  0x56, 0x7a, 0x6f, 0x9a, 0x9b, 0x35, 0x4d, 0x1d, 0xb6, 0x57, 0x47, 0x45, 0x7d, 0x5a, 0xe5, 0x8d,
+  0x0b, 0xd6, 0x18, 0xfb, 0x80, 0xd2, 0xd4, 0x2a, 0x20, 0xb1, 0xc0, 0xd8, 0x87, 0x54, 0x26, 0x05,
+  0xab, 0x0b, 0x8c, 0x5d, 0xbf, 0x2a, 0x29, 0x38, 0x95, 0xb8, 0xed, 0x5c, 0xd8, 0x9a, 0xb5, 0xa9,
+  0xa9, 0xa0, 0xb3, 0xcc, 0x5d, 0x03, 0x7e, 0xbd, 0x4a, 0x69, 0x0c, 0x32, 0x79, 0xd7, 0x00, 0xaf,
+  0x94, 0x2a, 0x0d, 0x5b, 0x5c, 0x5d, 0xd6, 0x40, 0x50, 0x6c, 0xde, 0x86, 0x05, 0xca, 0x45, 0x5d,
+  0x1c, 0x58, 0x59, 0xb6, 0x60, 0x40, 0xfd, 0xd6, 0x45, 0x21, 0xcb, 0x52, 0x15, 0x47, 0x71, 0x83,
+  0x5a, 0x03, 0x49, 0xb1, 0x79, 0x1b, 0x96, 0x7a, 0xb2, 0x64, 0x5b, 0xb7, 0x61, 0xa8, 0x29, 0x4b,
+  0xbe, 0x77, 0x0d, 0x47, 0x51, 0xad, 0x6a, 0x20, 0xd9, 0xac, 0x77, 0x15, 0x2c, 0xb2, 0x5e, 0xd9,
+  0x32, 0x82, 0x0f, 0x29, 0x7a, 0x15, 0x1c, 0x50, 0xaf, 0x6a, 0x61, 0x28, 0x15, 0x3c, 0x0d, 0x0f,
+  0xa5, 0x41, 0x89, 0x70, 0x05, 0x1d, 0xec, 0x0e, 0x21, 0x4a, 0x05, 0x25, 0x83, 0x14, 0x61, 0x3d,
+  0xc8, 0xa2, 0xb4, 0x64, 0x11, 0xf1, 0xde, 0xae, 0x51, 0x58, 0xb4, 0x7c, 0x50, 0x2b, 0xec, 0x5a,
+  0x85, 0x45, 0xed, 0xc7, 0x89, 0xe7, 0xfd, 0xfb, 0xf1, 0x6d, 0x75, 0xbf, 0x2e, 0x2a, 0x76, 0xfd,
+  0x4a, 0x54, 0x82, 0x83, 0x9a, 0x62, 0xd7, 0x2e, 0x44, 0x2d, 0xdd, 0xe9, 0xe3, 0x2f, 0xa8, 0x6e,
+  0x3a, 0x4d, 0xa5, 0x18, 0x95, 0x2b, 0x91, 0x25, 0xeb, 0x8d, 0x3c, 0xe2, 0xc3, 0xd1, 0xc3, 0x72,
+  0xf2, 0x88, 0x74, 0x58, 0xad, 0x60, 0x74, 0x36, 0xbc, 0x0e, 0xba, 0x87, 0x3a, 0x5e, 0x5b, 0xea,
+  0x56, 0x9a, 0x6a, 0x12, 0x44, 0xc8, 0x41, 0x67, 0x9b, 0x56, 0xd6, 0x89, 0x06, 0x2c, 0x9d, 0x0a,
+  0xd7, 0x36, 0x5e, 0xbe, 0x18, 0xdd, 0x18, 0x2d, 0xbd, 0x88, 0xbf, 0x1e, 0xcb, 0xe2, 0xc4, 0x5e,
+  0x19, 0xba, 0xb1, 0x69, 0xdf, 0x2c, 0x23, 0x06, 0x05, 0x0b, 0xff, 0x6a, 0x86, 0xab, 0x1b, 0xc8,
+  0x0e, 0x9e, 0x83, 0x8c, 0xbb, 0x0c, 0x04, 0x7f, 0x95, 0xd6, 0x96, 0x83, 0x8f, 0x44, 0x96, 0x45,
+  0xee, 0x2d, 0x4d, 0xa7, 0x59, 0x69, 0x3a, 0xe5, 0x7f, 0xdc, 0x33, 0x63, 0x4b, 0xcc, 0x9a, 0x7b,
+  0x3b, 0xe1, 0xbd, 0x63, 0x01, 0x31, 0x6b, 0x0c, 0x71, 0x42, 0x61, 0x1c, 0x67, 0x27, 0x33, 0xec,
+  0xc4, 0xcc, 0x66, 0x65, 0x40, 0x00, 0xd4, 0x99, 0x9f, 0xb0, 0x4f, 0xa7, 0x06, 0xed, 0x03, 0x92,
+  0xfb, 0x9d, 0x1a, 0x6c, 0xab, 0x11, 0x4a, 0x95, 0x4e, 0xa5, 0xeb, 0x38, 0xfa, 0x89, 0xa8, 0x3d,
+  0x95, 0xa3, 0x19, 0x90, 0x91, 0x55, 0xe7, 0x1e, 0xd8, 0xc4, 0x74, 0x3a, 0xc4, 0x89, 0x97, 0x51,
+  0x2a, 0xe4, 0x5f, 0xe7, 0xf8, 0xf8, 0x9b, 0x25, 0xfe, 0x92, 0xb0, 0x5b, 0xe8, 0x86, 0x12, 0xbc,
+  0x30, 0x98, 0xa6, 0x69, 0x94, 0x74, 0x7c, 0xe1, 0x50, 0x7f, 0x2a, 0xc0, 0x1d, 0xda, 0x44, 0xe0,
+  0x65, 0xd2, 0x02, 0x8e, 0xd6, 0x18, 0x8a, 0xa9, 0xba, 0x23, 0x9f, 0xd2, 0x64, 0x7a, 0xb4, 0x63,
+  0x3e, 0x23, 0x07, 0xaf, 0x6a, 0x6c, 0x38, 0xa8, 0xf6, 0x20, 0xc5, 0x60, 0x4f, 0x8e, 0x29, 0xf1,
+  0x96, 0x27, 0x81, 0xf6, 0xe5, 0xfb, 0xef, 0xb3, 0x41, 0x9f, 0xe2, 0x0e, 0x9e, 0x2b, 0x6c, 0x36,
+  0xf5, 0x10, 0x2f, 0x6f, 0x5d, 0xa6, 0xda, 0x4d, 0x2b, 0xbb, 0x2c, 0x97, 0x4f, 0x58, 0x02, 0x5d,
+  0x92, 0xbe, 0xf6, 0x31, 0x5a, 0x6a, 0x53, 0x85, 0x94, 0x45, 0xe3, 0x98, 0x2e, 0x1f, 0xcd, 0x3d,
+  0x8f, 0xc5, 0x7a, 0x34, 0xb3, 0x6b, 0xd2, 0x94, 0x4c, 0x69, 0xde, 0x79, 0x3e, 0x44, 0x48, 0xcb,
+  0x8b, 0x45, 0x60, 0xe2, 0x00, 0xf1, 0x15, 0x0f, 0xd3, 0x07, 0x72, 0xcd, 0x9c, 0x42, 0xbb, 0x17,
+  0xd0, 0xc8, 0x1c, 0x0f, 0x86, 0x63, 0x2b, 0x15, 0xba, 0xcb, 0xeb, 0x5d, 0x6c, 0xf4, 0x78, 0x4d,
+  0xeb, 0x3b, 0xc1, 0x43, 0x53, 0x4e, 0x54, 0x70, 0xa0, 0xbc, 0x31, 0x85, 0x52, 0x57, 0x2f, 0x45,
+  0x8f, 0xe6, 0x0d, 0x76, 0xeb, 0x39, 0x13, 0xab, 0x50, 0x0d, 0x70, 0x3c, 0xa8, 0x29, 0x11, 0x1c,
+  0x44, 0x79, 0x60, 0xc2, 0x71, 0x44, 0x5c, 0x8b, 0x05, 0x8b, 0x1f, 0x43, 0x46, 0x52, 0x53, 0x0a,
+  0x3d, 0x02, 0xc4, 0xcb, 0xa5, 0x9d, 0xb8, 0xe4, 0x8e, 0x35, 0x6c, 0x05, 0x7c, 0x30, 0xd8, 0x3b,
+  0xc3, 0xeb, 0x6b, 0x6f, 0xf0, 0xbe, 0xff, 0x1e, 0xf8, 0xb2, 0x7c, 0x16, 0x4e, 0xd2, 0xe9, 0x67,
+  0x83, 0x8b, 0xb3, 0xe6, 0x2a, 0xa8, 0xe5, 0xec, 0x2f, 0xb9, 0x33, 0x23, 0x34, 0xbf, 0xd5, 0x23,
+  0xa8, 0x0f, 0xf9, 0xdb, 0x1e, 0x1c, 0x1c, 0x5a, 0xfb, 0x41, 0x16, 0x04, 0xa5, 0x49, 0xb0, 0xf4,
+  0x40, 0x64, 0xbe, 0x2e, 0x9d, 0xa7, 0x38, 0x70, 0x96, 0xce, 0x5f, 0xba, 0xa4, 0xdb, 0x40, 0xab,
+  0x6d, 0xe6, 0xca, 0x01, 0xf3, 0x95, 0x88, 0x83, 0x27, 0x90, 0xe6, 0x95, 0x4a, 0x3c, 0xd7, 0x82,
+  0x4c, 0x08, 0x05, 0x1b, 0x84, 0xd7, 0xcc, 0x1a, 0x2d, 0x4f, 0xbe, 0xaa, 0x91, 0x82, 0xd5, 0x78,
+  0x12, 0x52, 0x70, 0x35, 0xf7, 0x16, 0x49, 0xf7, 0x4f, 0xda, 0xd9, 0xf5, 0x5c, 0x1b, 0xa4, 0x46,
+  0xe7, 0xb7, 0x41, 0xa1, 0x2d, 0x58, 0x07, 0x7e, 0xdb, 0x37, 0xd2, 0x4e, 0xb6, 0x64, 0xfb, 0xae,
+  0x25, 0xf3, 0xae, 0xe7, 0x66, 0x39, 0x36, 0xd8, 0x3d, 0x48, 0x95, 0xb9, 0xf7, 0x6b, 0x1c, 0x0f,
+  0xdb, 0x72, 0x52, 0xdc, 0x54, 0x63, 0x55, 0xbd, 0x2c, 0xb3, 0xa9, 0xad, 0xc6, 0xc2, 0xcd, 0x5d,
+  0x59, 0x75, 0x2d, 0xcf, 0x05, 0x9f, 0x9c, 0xca, 0xd6, 0x42, 0x27, 0xbf, 0x0a, 0xcc, 0x12, 0x8c,
+  0xac, 0x5a, 0x71, 0x60, 0x1a, 0xfa, 0x52, 0x50, 0xdd, 0x69, 0x7c, 0x4d, 0x6e, 0xe8, 0x8c, 0x25,
+  0xe4, 0xcf, 0x4f, 0xbb, 0xd9, 0xaf, 0xbb, 0x5b, 0x10, 0x96, 0x45, 0x7e, 0xd9, 0xd4, 0xbd, 0xc6,
+  0xbc, 0xae, 0xfc, 0xbb, 0xdd, 0xb9, 0xa3, 0x56, 0x2d, 0xfa, 0x26, 0x9f, 0x8f, 0x5b, 0x96, 0x05,
+  0x22, 0x78, 0x40, 0x6b, 0x8a, 0xf7, 0xca, 0xa7, 0xdd, 0x24, 0x97, 0xb7, 0x7c, 0xf6, 0x2c, 0x5d,
+  0x59, 0xa2, 0x9c, 0xdb, 0x26, 0x90, 0x52, 0xbd, 0x16, 0x78, 0x6a, 0x68, 0xc6, 0x83, 0x61, 0x3e,
+  0x83, 0x2e, 0x2d, 0xbb, 0xc5, 0x50, 0x49, 0x79, 0xdc, 0x58, 0xfa, 0xeb, 0x23, 0x5f, 0x8c, 0xcd,
+  0xd7, 0x6b, 0xf5, 0xd8, 0x6d, 0x85, 0x73, 0xdf, 0x6f, 0x9d, 0x34, 0xdf, 0xb4, 0x56, 0x78, 0x07,
+  0xbd, 0xad, 0x9e, 0x37, 0xfb, 0x15, 0x6c, 0xf3, 0xc1, 0xab, 0x6f, 0xae, 0x21, 0x91, 0x33, 0xf0,
+  0x58, 0x35, 0xcc, 0x86, 0x67, 0x73, 0xbc, 0xb6, 0xab, 0x94, 0xa4, 0xd4, 0x56, 0xad, 0x3d, 0x38,
+  0xf7, 0x19, 0xf9, 0x56, 0x6a, 0x4d, 0x41, 0x29, 0x83, 0x79, 0xf1, 0x0c, 0x35, 0x22, 0xc4, 0x1c,
+  0x39, 0x30, 0xa4, 0x39, 0xdf, 0x2a, 0xa9, 0xa5, 0x90, 0x46, 0xb1, 0x4b, 0x5e, 0xb6, 0x65, 0x03,
+  0x57, 0x35, 0xf0, 0xbf, 0xec, 0x64, 0xb7, 0xb5, 0x97, 0x1d, 0xfd, 0x37, 0x3c, 0x1d, 0xf5, 0xf7,
+  0xc9, 0xff, 0x0b, 0xf1, 0x2b, 0x5a, 0xe3, 0xb7, 0x3c, 0x00, 0x00,
+};
+
+#endif // WEB_ASSETS_H
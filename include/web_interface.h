@@ -2,399 +2,736 @@
 // WEB INTERFACE - Phase 2
 // Adds http://clock.local configuration interface
 // 
-// Include this file in main.cpp and call setup_web_server() in setup()
+// Include this file in main.cpp and call setup_web_server() once WiFi is up.
+// Requests are served by ESPAsyncWebServer on the AsyncTCP task (pinned to
+// the worker core), so a slow client never holds up the net task or the
+// render core, and several browsers can be connected at once.
 // ============================================================================
 
 #ifndef WEB_INTERFACE_H
 #define WEB_INTERFACE_H
 
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
 #include <ESPmDNS.h>
 #include <Update.h>
+#include <mbedtls/sha256.h>
 #include <ArduinoJson.h>
+#include <stdarg.h>
+#include "web_assets.h"   // Generated from web/ by embed_web.py
 
 // External references to config and functions from main.cpp
 extern ClockConfig config;
-extern void save_config();
 extern void load_config();
 extern LilyGo_Class amoled;
 extern float battery_voltage;
-extern bool is_charging();
+extern float smoothed_voltage;
+extern volatile uint8_t charge_mode;
+extern volatile uint8_t battery_pct;
+extern volatile uint32_t charger_irq_count;
+extern volatile uint8_t charger_last_fault;
 extern int sunrise_time, sunset_time;
+extern uint32_t inv_px_per_sec;
+extern int32_t tick_phase_err_ms, tick_phase_worst_ms;
+extern volatile uint8_t wifi_state;
+extern volatile uint32_t wifi_connect_ms, wifi_reconnect_count;
 
-WebServer web_server(80);
+AsyncWebServer web_server(80);
+AsyncEventSource status_events("/api/events");
+volatile uint32_t web_restart_at = 0;   // millis() to reboot at, 0 = none
 
 // ============================================================================
-// HTML PAGE - Embedded (compressed with gzip would be better, but keeping simple)
+// LIVE STATUS - Shared by /api/status and the /api/events push stream
 // ============================================================================
 
-const char HTML_PAGE[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-<meta charset="UTF-8">
-<meta name="viewport" content="width=device-width,initial-scale=1">
-<title>Flip Clock Config</title>
-<style>
-*{margin:0;padding:0;box-sizing:border-box}
-body{font-family:-apple-system,BlinkMacSystemFont,'Segoe UI',Roboto,sans-serif;background:#0a0a0a;color:#e0e0e0;padding:20px}
-.container{max-width:800px;margin:0 auto}
-h1{color:#ff3333;margin-bottom:10px;font-size:28px}
-h2{color:#ff6666;margin:25px 0 12px;font-size:18px;border-bottom:1px solid #333;padding-bottom:6px}
-.subtitle{color:#888;margin-bottom:25px;font-size:14px}
-.status-grid{display:grid;grid-template-columns:repeat(auto-fit,minmax(150px,1fr));gap:12px;margin-bottom:25px}
-.status-card{background:#1a1a1a;border:1px solid #333;border-radius:6px;padding:12px}
-.status-label{color:#888;font-size:11px;margin-bottom:4px}
-.status-value{color:#fff;font-size:18px;font-weight:600}
-.form-group{margin-bottom:16px}
-label{display:block;color:#aaa;margin-bottom:4px;font-size:13px}
-input[type="text"],input[type="password"],input[type="number"],select{width:100%;padding:8px;background:#1a1a1a;border:1px solid #333;border-radius:4px;color:#fff;font-size:13px}
-input[type="range"]{width:100%;height:5px;background:#333;border-radius:3px}
-input[type="checkbox"]{width:18px;height:18px;margin-right:8px;vertical-align:middle}
-.slider-val{display:inline-block;background:#ff3333;color:#fff;padding:2px 6px;border-radius:3px;font-size:11px;margin-left:8px;min-width:35px;text-align:center}
-button{background:#ff3333;color:#fff;border:none;padding:10px 20px;border-radius:4px;font-size:14px;cursor:pointer;margin-right:8px;margin-bottom:8px}
-button:hover{background:#ff5555}
-button.sec{background:#333}
-button.sec:hover{background:#444}
-.color-grid{display:grid;grid-template-columns:repeat(5,1fr);gap:8px;margin-top:8px}
-.color-opt{width:100%;height:40px;border:2px solid #333;border-radius:4px;cursor:pointer}
-.color-opt.sel{border-color:#ff3333;border-width:3px}
-.msg{margin-top:15px;padding:10px;border-radius:4px;font-size:13px}
-.msg.ok{background:#1b5e20;color:#4caf50}
-.msg.err{background:#b71c1c;color:#f44336}
-small{color:#666;font-size:11px}
-@media(max-width:600px){body{padding:10px}h1{font-size:22px}.status-grid{grid-template-columns:1fr}}
-</style>
-</head>
-<body>
-<div class="container">
-<h1>⏰ Flip Clock</h1>
-<p class="subtitle">Configuration Interface • Phase 2</p>
-
-<h2>📊 Status</h2>
-<div class="status-grid">
-  <div class="status-card"><div class="status-label">Time</div><div class="status-value" id="time">--:--</div></div>
-  <div class="status-card"><div class="status-label">Battery</div><div class="status-value" id="batt">--%</div></div>
-  <div class="status-card"><div class="status-label">WiFi</div><div class="status-value" id="wifi">--</div></div>
-  <div class="status-card"><div class="status-label">Uptime</div><div class="status-value" id="up">--</div></div>
-</div>
-
-<h2>🎨 Display</h2>
-<div class="form-group">
-  <label><input type="checkbox" id="show_sec"> Show seconds</label>
-</div>
-<div class="form-group">
-  <label><input type="checkbox" id="show_date"> Show date</label>
-</div>
-<div class="form-group">
-  <label>Color Scheme</label>
-  <div class="color-grid">
-    <div class="color-opt" style="background:#ff3333" data-c="0"></div>
-    <div class="color-opt" style="background:#33ff33" data-c="1"></div>
-    <div class="color-opt" style="background:#3333ff" data-c="2"></div>
-    <div class="color-opt" style="background:#ffffff" data-c="3"></div>
-    <div class="color-opt" style="background:#ffaa00" data-c="4"></div>
-  </div>
-</div>
-
-<h2>💡 Brightness</h2>
-<div class="form-group">
-  <label><input type="checkbox" id="auto_br"> Auto-brightness (sunrise/sunset)</label>
-</div>
-<div class="form-group">
-  <label>Day <span class="slider-val" id="day_v">200</span></label>
-  <input type="range" id="day_br" min="50" max="255" value="200">
-</div>
-<div class="form-group">
-  <label>Night <span class="slider-val" id="night_v">40</span></label>
-  <input type="range" id="night_br" min="10" max="150" value="40">
-</div>
-<div class="form-group">
-  <label>Transition (minutes) <span class="slider-val" id="trans_v">30</span></label>
-  <input type="range" id="trans" min="5" max="60" value="30">
-</div>
-
-<h2>🌍 Location</h2>
-<div class="form-group">
-  <label>Latitude</label>
-  <input type="number" id="lat" step="0.0001" value="39.7555">
-  <small>Current sunrise: <span id="rise">--:--</span>, sunset: <span id="set">--:--</span></small>
-</div>
-<div class="form-group">
-  <label>Longitude</label>
-  <input type="number" id="lon" step="0.0001" value="-119.8135">
-</div>
-<div class="form-group">
-  <label>Timezone</label>
-  <input type="text" id="tz" value="PST8PDT,M3.2.0/2,M11.1.0/2">
-</div>
-
-<h2>📡 WiFi</h2>
-<div class="form-group">
-  <label>SSID</label>
-  <input type="text" id="ssid">
-</div>
-<div class="form-group">
-  <label>Password</label>
-  <input type="password" id="pass">
-  <small>Leave blank to keep current password</small>
-</div>
-
-<h2>🌤️ Weather (Optional)</h2>
-<div class="form-group">
-  <label><input type="checkbox" id="wthr_en"> Enable weather</label>
-</div>
-<div class="form-group">
-  <label>OpenWeatherMap API Key</label>
-  <input type="text" id="wthr_key" placeholder="Get free key at openweathermap.org">
-  <small>Free: 60 calls/min, 1000/day</small>
-</div>
-
-<h2>⚙️ Actions</h2>
-<button onclick="save()">💾 Save Config</button>
-<button class="sec" onclick="restart()">🔄 Restart</button>
-<button class="sec" onclick="exportCfg()">📥 Export</button>
-<div id="msg"></div>
-
-</div>
-
-<script>
-setInterval(updateStatus,2000);
-updateStatus();
-loadCfg();
-
-document.getElementById('day_br').oninput=function(){document.getElementById('day_v').textContent=this.value};
-document.getElementById('night_br').oninput=function(){document.getElementById('night_v').textContent=this.value};
-document.getElementById('trans').oninput=function(){document.getElementById('trans_v').textContent=this.value};
-
-document.querySelectorAll('.color-opt').forEach(e=>{
-  e.onclick=function(){
-    document.querySelectorAll('.color-opt').forEach(x=>x.classList.remove('sel'));
-    this.classList.add('sel');
-  };
-});
-
-async function updateStatus(){
-  try{
-    const r=await fetch('/api/status');
-    const d=await r.json();
-    document.getElementById('time').textContent=d.time;
-    document.getElementById('batt').textContent=d.batt+(d.chrg?' ⚡':'');
-    document.getElementById('wifi').textContent=d.rssi+' dBm';
-    document.getElementById('up').textContent=d.up;
-    document.getElementById('rise').textContent=d.rise;
-    document.getElementById('set').textContent=d.set;
-  }catch(e){}
+// The dashboard fields. Built from values the worker tasks already cache, so
+// reading it never touches the ADC or the I2C bus.
+struct LiveStatus {
+  char time[16];
+  uint8_t batt;
+  bool chrg;
+  int8_t rssi;
+  char up[16];
+  char rise[8];
+  char set[8];
+  uint8_t wifi;
+};
+
+void status_live_read(LiveStatus& s) {
+  ClockSnapshot now;
+  clock_now(&now);
+  if (now.valid) {
+    strftime(s.time, sizeof(s.time), "%I:%M %p", &now.tm);
+  } else {
+    strcpy(s.time, "--:--");
+  }
+  
+  // Uptime
+  unsigned long up_sec = millis() / 1000;
+  unsigned long up_min = up_sec / 60;
+  unsigned long up_hr = up_min / 60;
+  unsigned long up_day = up_hr / 24;
+  
+  if (up_day > 0) {
+    snprintf(s.up, sizeof(s.up), "%lud %luh", up_day, up_hr % 24);
+  } else if (up_hr > 0) {
+    snprintf(s.up, sizeof(s.up), "%luh %lum", up_hr, up_min % 60);
+  } else {
+    snprintf(s.up, sizeof(s.up), "%lum", up_min);
+  }
+  
+  // Sunrise/sunset
+  snprintf(s.rise, sizeof(s.rise), "%02d:%02d", sunrise_time / 60, sunrise_time % 60);
+  snprintf(s.set, sizeof(s.set), "%02d:%02d", sunset_time / 60, sunset_time % 60);
+  
+  s.batt = battery_pct;                  // Smoothed by the charger task
+  s.chrg = (charge_mode == CHARGE_CHG);
+  s.rssi = WiFi.RSSI();
+  s.wifi = wifi_state;
 }
 
-async function loadCfg(){
-  try{
-    const r=await fetch('/api/config');
-    const c=await r.json();
-    document.getElementById('show_sec').checked=c.show_sec;
-    document.getElementById('show_date').checked=c.show_date;
-    document.getElementById('auto_br').checked=c.auto_br;
-    document.getElementById('day_br').value=c.day_br;
-    document.getElementById('night_br').value=c.night_br;
-    document.getElementById('trans').value=c.trans;
-    document.getElementById('day_v').textContent=c.day_br;
-    document.getElementById('night_v').textContent=c.night_br;
-    document.getElementById('trans_v').textContent=c.trans;
-    document.getElementById('lat').value=c.lat;
-    document.getElementById('lon').value=c.lon;
-    document.getElementById('tz').value=c.tz;
-    document.getElementById('ssid').value=c.ssid;
-    document.getElementById('wthr_en').checked=c.wthr_en;
-    document.getElementById('wthr_key').value=c.wthr_key;
-    document.querySelectorAll('.color-opt')[c.color].classList.add('sel');
-  }catch(e){console.error(e)}
+// Add the fields of `s` that differ from `prev` (all of them if prev is null).
+// Returns the number of fields added.
+int status_live_json(JsonDocument& doc, const LiveStatus& s, const LiveStatus* prev) {
+  int n = 0;
+  if (!prev || strcmp(s.time, prev->time)) { doc["time"] = s.time; n++; }
+  if (!prev || s.batt != prev->batt) { doc["batt"] = s.batt; n++; }
+  if (!prev || s.chrg != prev->chrg) { doc["chrg"] = s.chrg; n++; }
+  if (!prev || s.rssi != prev->rssi) { doc["rssi"] = s.rssi; n++; }
+  if (!prev || strcmp(s.up, prev->up)) { doc["up"] = s.up; n++; }
+  if (!prev || strcmp(s.rise, prev->rise)) { doc["rise"] = s.rise; n++; }
+  if (!prev || strcmp(s.set, prev->set)) { doc["set"] = s.set; n++; }
+  if (!prev || s.wifi != prev->wifi) { doc["wifi"] = WIFI_STATE_NAMES[s.wifi]; n++; }
+  return n;
 }
 
-async function save(){
-  const c={
-    show_sec:document.getElementById('show_sec').checked,
-    show_date:document.getElementById('show_date').checked,
-    auto_br:document.getElementById('auto_br').checked,
-    day_br:parseInt(document.getElementById('day_br').value),
-    night_br:parseInt(document.getElementById('night_br').value),
-    trans:parseInt(document.getElementById('trans').value),
-    lat:parseFloat(document.getElementById('lat').value),
-    lon:parseFloat(document.getElementById('lon').value),
-    tz:document.getElementById('tz').value,
-    ssid:document.getElementById('ssid').value,
-    pass:document.getElementById('pass').value,
-    wthr_en:document.getElementById('wthr_en').checked,
-    wthr_key:document.getElementById('wthr_key').value,
-    color:parseInt(document.querySelector('.color-opt.sel').dataset.c)
-  };
-  
-  try{
-    const r=await fetch('/api/config',{
-      method:'POST',
-      headers:{'Content-Type':'application/json'},
-      body:JSON.stringify(c)
-    });
-    
-    if(r.ok){
-      document.getElementById('msg').innerHTML='<div class="msg ok">✓ Saved! Restart to apply changes.</div>';
-    }else{
-      document.getElementById('msg').innerHTML='<div class="msg err">✗ Save failed</div>';
+// ============================================================================
+// STATUS STREAM - Server-Sent Events on /api/events
+//
+// Once per clock second, and only while a dashboard is connected, the net
+// task reads a single LiveStatus, diffs it against the last one sent and
+// broadcasts the changed fields, so ten dashboards cost the same reads as
+// one. AsyncEventSource queues the event per client, so a slow browser only
+// delays itself. New clients get the full snapshot on connect. Until SNTP
+// has set the clock there are no clock seconds, so the stream falls back to
+// an uptime tick and battery and WiFi changes still go out.
+// ============================================================================
+
+const size_t SSE_MAX_CLIENTS = 4;
+const uint32_t SSE_FALLBACK_TICK_MS = 1000;
+
+struct StatusStream {
+  LiveStatus last;
+  bool have_last = false;
+  uint32_t seen_second = 0;
+  uint32_t last_tick = 0;    // millis() of the last read
+  uint32_t pushes = 0;       // Diff events broadcast (shared by all clients)
+};
+StatusStream status_stream;
+
+// Serialize the live fields that changed. Returns 0 if nothing changed.
+size_t status_stream_event(char* buf, size_t size, const LiveStatus& s, const LiveStatus* prev) {
+  StaticJsonDocument<256> doc;
+  if (status_live_json(doc, s, prev) == 0) return 0;
+  return serializeJson(doc, buf, size);
+}
+
+// Runs on the AsyncTCP task
+void status_stream_connect(AsyncEventSourceClient* client) {
+  if (status_events.count() > SSE_MAX_CLIENTS) {
+    client->close();
+    return;
+  }
+  LiveStatus cur;
+  char event[256];
+  status_live_read(cur);
+  status_stream_event(event, sizeof(event), cur, nullptr);
+  client->send(event, nullptr, millis(), 3000);
+}
+
+// Called from the net task
+void status_stream_tick() {
+  if (status_events.count() == 0) {
+    status_stream.have_last = false;
+    return;
+  }
+  if (!clock_changed(CLOCK_SECOND, status_stream.seen_second)) {
+    if (millis() - status_stream.last_tick < SSE_FALLBACK_TICK_MS) return;
+    ClockSnapshot now;
+    clock_now(&now);
+    if (now.valid) return;  // Clock seconds are driving the stream
+  }
+  status_stream.last_tick = millis();
+
+  LiveStatus cur;
+  status_live_read(cur);
+  if (status_stream.have_last) {
+    char event[256];
+    if (status_stream_event(event, sizeof(event), cur, &status_stream.last)) {
+      status_events.send(event, nullptr, millis());
+      status_stream.pushes++;
+    }
+  }
+  status_stream.last = cur;
+  status_stream.have_last = true;
+}
+
+// ============================================================================
+// FIRMWARE UPDATE - Streaming OTA on /api/update
+//
+// The multipart upload is written straight into the inactive OTA partition as
+// each TCP chunk arrives, so the image is never held in RAM. The client sends
+// the SHA-256 of firmware.bin in X-Firmware-SHA256; the running hash must
+// match before Update.end() is allowed to switch the boot partition. Progress
+// and throughput go out as "ota" events on the status stream.
+//
+// The hash comes from the same client as the image, so it only catches a
+// damaged upload. What keeps other hosts on the network from flashing the
+// clock is X-OTA-Token: a random per-device secret, made on first boot, kept
+// in NVS and only ever printed on the serial console. Without it the upload
+// is refused before Update.begin() touches flash.
+// ============================================================================
+
+const uint32_t OTA_REPORT_MS = 250;
+const size_t OTA_TOKEN_LEN = 32;           // Hex chars - 128 bits
+
+struct OtaState {
+  AsyncWebServerRequest* owner = nullptr;  // Upload in progress, one at a time
+  bool done = false;                       // Verified and boot partition switched
+  mbedtls_sha256_context sha;
+  uint8_t expected[32];
+  size_t written = 0;
+  size_t total = 0;                        // Request length, includes multipart framing
+  uint32_t started_at = 0;
+  uint32_t last_report = 0;
+  char error[48] = "";
+};
+OtaState ota;
+char ota_token[OTA_TOKEN_LEN + 1] = "";
+
+// Load the OTA token, making one on first boot (after WiFi is up, so
+// esp_random() is backed by RF noise)
+void ota_token_begin() {
+  Preferences p;
+  p.begin("ota", false);
+  String stored = p.getString("token", "");
+  if (stored.length() == OTA_TOKEN_LEN) {
+    strlcpy(ota_token, stored.c_str(), sizeof(ota_token));
+  } else {
+    for (size_t i = 0; i < OTA_TOKEN_LEN; i += 8) {
+      snprintf(ota_token + i, 9, "%08lx", (unsigned long)esp_random());
     }
-  }catch(e){
-    document.getElementById('msg').innerHTML='<div class="msg err">✗ Error: '+e+'</div>';
+    p.putString("token", ota_token);
   }
+  p.end();
+  Serial.printf("🔑 OTA token: %s\n", ota_token);
 }
 
-async function restart(){
-  if(!confirm('Restart clock? Takes ~30 seconds.'))return;
-  await fetch('/api/restart',{method:'POST'});
-  document.getElementById('msg').innerHTML='<div class="msg ok">Restarting... refresh in 30s</div>';
+// Constant-time compare, so the token cannot be guessed a byte at a time
+bool ota_authorized(AsyncWebServerRequest* request) {
+  const AsyncWebHeader* h = request->getHeader("X-OTA-Token");
+  if (!ota_token[0] || !h || h->value().length() != OTA_TOKEN_LEN) return false;
+  const char* given = h->value().c_str();
+  uint8_t diff = 0;
+  for (size_t i = 0; i < OTA_TOKEN_LEN; i++) diff |= given[i] ^ ota_token[i];
+  return diff == 0;
 }
 
-function exportCfg(){
-  fetch('/api/config')
-    .then(r=>r.json())
-    .then(d=>{
-      const b=new Blob([JSON.stringify(d,null,2)],{type:'application/json'});
-      const u=URL.createObjectURL(b);
-      const a=document.createElement('a');
-      a.href=u;
-      a.download='clock_config.json';
-      a.click();
+bool ota_parse_sha256(const String& hex, uint8_t* out) {
+  if (hex.length() != 64) return false;
+  for (int i = 0; i < 32; i++) {
+    char byte[3] = {hex[2 * i], hex[2 * i + 1], '\0'};
+    char* end;
+    out[i] = (uint8_t)strtoul(byte, &end, 16);
+    if (*end) return false;
+  }
+  return true;
+}
+
+void ota_report(const char* state) {
+  uint32_t now = millis();
+  uint32_t elapsed = max(now - ota.started_at, (uint32_t)1);
+  char event[160];
+  snprintf(event, sizeof(event),
+           "{\"state\":\"%s\",\"bytes\":%u,\"total\":%u,\"kbps\":%u,\"error\":\"%s\"}", state,
+           (unsigned)ota.written, (unsigned)ota.total, (unsigned)(ota.written * 8 / elapsed), ota.error);
+  status_events.send(event, "ota", now);
+  ota.last_report = now;
+}
+
+void ota_fail(const char* why) {
+  Update.abort();
+  mbedtls_sha256_free(&ota.sha);
+  strlcpy(ota.error, why, sizeof(ota.error));
+  Serial.printf("✗ Firmware update failed: %s\n", why);
+  ota_report("failed");
+  ota.owner = nullptr;
+}
+
+void handle_update_upload(AsyncWebServerRequest* request, const String& filename, size_t index,
+                          uint8_t* data, size_t len, bool final) {
+  if (index == 0) {
+    if (!ota_authorized(request)) return;  // Answered with 403 below, nothing touched
+    if (ota.owner) return;  // Someone else is updating - answered with 409 below
+    ota.owner = request;
+    ota.done = false;
+    ota.written = 0;
+    ota.total = request->contentLength();
+    ota.started_at = millis();
+    ota.error[0] = '\0';
+    mbedtls_sha256_init(&ota.sha);
+    mbedtls_sha256_starts(&ota.sha, 0);
+    request->onDisconnect([request]() {
+      if (ota.owner != request) return;
+      if (ota.done) ota.owner = nullptr;  // Already switched - just never got to reply
+      else ota_fail("Upload aborted");
     });
+
+    const AsyncWebHeader* sha = request->getHeader("X-Firmware-SHA256");
+    if (!sha || !ota_parse_sha256(sha->value(), ota.expected)) {
+      ota_fail("Missing or bad X-Firmware-SHA256");
+      return;
+    }
+    if (!Update.begin(UPDATE_SIZE_UNKNOWN, U_FLASH)) {
+      ota_fail(Update.errorString());
+      return;
+    }
+    Serial.printf("⬆️  Firmware update started: %s\n", filename.c_str());
+  }
+  if (ota.owner != request) return;
+
+  mbedtls_sha256_update(&ota.sha, data, len);
+  if (Update.write(data, len) != len) {
+    ota_fail(Update.errorString());
+    return;
+  }
+  ota.written += len;
+  if (millis() - ota.last_report >= OTA_REPORT_MS) ota_report("writing");
+
+  if (final) {
+    uint8_t digest[32];
+    mbedtls_sha256_finish(&ota.sha, digest);
+    if (memcmp(digest, ota.expected, sizeof(digest)) != 0) {
+      ota_fail("SHA-256 mismatch");
+      return;
+    }
+    mbedtls_sha256_free(&ota.sha);
+    if (!Update.end(true)) {  // Checks the image and switches the boot partition
+      ota_fail(Update.errorString());
+      return;
+    }
+    ota.done = true;
+    Serial.printf("✓ Firmware update verified: %u bytes in %lums\n", (unsigned)ota.written,
+                  (unsigned long)(millis() - ota.started_at));
+    ota_report("done");
+  }
+}
+
+// Runs once the whole request body has been through handle_update_upload()
+void handle_update(AsyncWebServerRequest* request) {
+  if (!ota_authorized(request)) {
+    request->send(403, "text/plain", "Missing or wrong X-OTA-Token");
+    return;
+  }
+  if (ota.owner != request) {
+    request->send(ota.owner ? 409 : 400, "text/plain",
+                  ota.owner ? "Update already in progress" : (ota.error[0] ? ota.error : "No firmware"));
+    return;
+  }
+  ota.owner = nullptr;
+  if (!ota.done) {
+    request->send(400, "text/plain", "Upload incomplete");
+    return;
+  }
+  request->send(200, "text/plain", "Update OK - restarting");
+  web_restart_at = millis() + 1000;
 }
-</script>
-</body>
-</html>
-)rawliteral";
 
 // ============================================================================
-// API HANDLERS
+// METRICS - Prometheus text exposition on /metrics
+//
+// The body is produced by a chunked-response filler, one metric family at a
+// time: each family is formatted into a fixed buffer on the stack and copied
+// into the library's send buffer only if it fits whole, so a scrape never
+// touches the heap on our side (no JSON document, no String). The filler
+// keeps its place in a captured counter, so every family is a consistent
+// read even when the body spans several TCP sends.
 // ============================================================================
 
-void handle_root() {
-  web_server.send_P(200, "text/html", HTML_PAGE);
+const size_t METRICS_FAMILY_MAX = 1536;   // Largest family: one probe histogram
+const char* const CHARGE_STATE_NAMES[] = {"bat", "chg", "flt"};
+
+// Append to a fixed buffer; families are sized so this never truncates
+__attribute__((format(printf, 4, 5)))
+size_t metrics_put(char* out, size_t cap, size_t len, const char* fmt, ...) {
+  if (len >= cap) return len;
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(out + len, cap - len, fmt, args);
+  va_end(args);
+  return n < 0 ? len : min(len + n, cap - 1);
 }
 
-void handle_status() {
-  StaticJsonDocument<512> doc;
-  
-  struct tm ti;
-  char tbuf[16], upbuf[32], risebuf[8], setbuf[8];
-  
-  if (getLocalTime(&ti)) {
-    strftime(tbuf, sizeof(tbuf), "%I:%M %p", &ti);
-  } else {
-    strcpy(tbuf, "--:--");
+size_t metrics_head(char* out, size_t cap, size_t len, const char* name, const char* type, const char* help) {
+  return metrics_put(out, cap, len, "# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+// One gauge or counter with a single sample
+size_t metrics_value(char* out, size_t cap, const char* name, const char* type, const char* help, double v) {
+  size_t len = metrics_head(out, cap, 0, name, type, help);
+  return metrics_put(out, cap, len, "%s %.10g\n", name, v);
+}
+
+enum MetricsFamily {
+  MET_UPTIME, MET_BATT_VOLTS, MET_BATT_PCT, MET_CHARGE_STATE, MET_VBUS, MET_RSSI, MET_HEAP_FREE,
+  MET_HEAP_BLOCK, MET_NTP_SYNCED, MET_NTP_OFFSET, MET_NTP_RTT, MET_NTP_SYNCS, MET_WIFI_RECONNECTS,
+  MET_WIFI_CONNECT, MET_CHARGER_IRQ, MET_CONFIG_WRITES, MET_PANEL, MET_AWAKE, MET_CURRENT,
+#if PERF_PROBES
+  MET_RENDER_HEAD, MET_RENDER_PROBE, MET_RENDER_MAX = MET_RENDER_PROBE + PERF_PROBE_COUNT,
+#endif
+  MET_COUNT
+};
+
+// Format family `f` into `out`. Returns its length.
+size_t metrics_family(int f, char* out, size_t cap) {
+  switch (f) {
+    case MET_UPTIME:
+      return metrics_value(out, cap, "clock_uptime_seconds", "counter", "Seconds since boot", millis() / 1000.0);
+    case MET_BATT_VOLTS:
+      return metrics_value(out, cap, "clock_battery_volts", "gauge", "Smoothed battery voltage", smoothed_voltage);
+    case MET_BATT_PCT:
+      return metrics_value(out, cap, "clock_battery_percent", "gauge", "Battery charge estimate", battery_pct);
+    case MET_CHARGE_STATE: {
+      size_t len = metrics_head(out, cap, 0, "clock_charge_state", "gauge", "1 for the current charger mode");
+      for (int i = 0; i < 3; i++) {
+        len = metrics_put(out, cap, len, "clock_charge_state{state=\"%s\"} %d\n", CHARGE_STATE_NAMES[i], charge_mode == i);
+      }
+      return len;
+    }
+    case MET_VBUS:
+      return metrics_value(out, cap, "clock_vbus_present", "gauge", "USB power present", vbus_present());
+    case MET_RSSI:
+      if (WiFi.status() != WL_CONNECTED) return 0;
+      return metrics_value(out, cap, "clock_wifi_rssi_dbm", "gauge", "WiFi signal strength", WiFi.RSSI());
+    case MET_HEAP_FREE:
+      return metrics_value(out, cap, "clock_heap_free_bytes", "gauge", "Free internal heap", ESP.getFreeHeap());
+    case MET_HEAP_BLOCK:
+      return metrics_value(out, cap, "clock_heap_largest_block_bytes", "gauge", "Largest free internal heap block",
+                           ESP.getMaxAllocHeap());
+    case MET_NTP_SYNCED:
+      return metrics_value(out, cap, "clock_ntp_synced", "gauge", "1 once NTP has set the clock", time_synced);
+    case MET_NTP_OFFSET:
+      return metrics_value(out, cap, "clock_ntp_offset_seconds", "gauge", "Correction applied by the last NTP sync",
+                           ntp_stats.offset_ms / 1000.0);
+    case MET_NTP_RTT:
+      return metrics_value(out, cap, "clock_ntp_rtt_seconds", "gauge", "Round trip of the last NTP sync",
+                           ntp_stats.rtt_ms / 1000.0);
+    case MET_NTP_SYNCS:
+      return metrics_value(out, cap, "clock_ntp_syncs_total", "counter", "Successful NTP syncs", ntp_stats.count);
+    case MET_WIFI_RECONNECTS:
+      return metrics_value(out, cap, "clock_wifi_reconnects_total", "counter", "WiFi reconnections",
+                           wifi_reconnect_count);
+    case MET_WIFI_CONNECT:
+      return metrics_value(out, cap, "clock_wifi_connect_seconds", "gauge", "Duration of the last WiFi connect",
+                           wifi_connect_ms / 1000.0);
+    case MET_CHARGER_IRQ:
+      return metrics_value(out, cap, "clock_charger_interrupts_total", "counter", "BQ25896 INT pulses",
+                           charger_irq_count);
+    case MET_CONFIG_WRITES:
+      return metrics_value(out, cap, "clock_config_writes_total", "counter", "Config blobs written to NVS",
+                           config_writes);
+    case MET_PANEL:
+      return metrics_value(out, cap, "clock_panel_brightness", "gauge", "Level last sent to the panel (0-255)",
+                           panel_brightness);
+    case MET_AWAKE:
+      return metrics_value(out, cap, "clock_awake_ratio", "gauge", "Share of time the tasks were running",
+                           power.awake_pct / 100.0);
+    case MET_CURRENT:
+      return metrics_value(out, cap, "clock_estimated_current_amps", "gauge", "Modelled battery current",
+                           power_estimate_ma(panel_brightness) / 1000.0);
+#if PERF_PROBES
+    case MET_RENDER_HEAD:
+      return metrics_head(out, cap, 0, "clock_render_seconds", "histogram", "Callback run time since boot");
+    case MET_RENDER_MAX: {
+      size_t len = metrics_head(out, cap, 0, "clock_render_max_seconds", "gauge", "Slowest call in the last minute");
+      for (int i = 0; i < PERF_PROBE_COUNT; i++) {
+        PerfSummary s;
+        perf_summary(i, s);
+        len = metrics_put(out, cap, len, "clock_render_max_seconds{probe=\"%s\"} %.6f\n", PERF_NAMES[i], s.max_us / 1e6);
+      }
+      return len;
+    }
+    default:
+      if (f >= MET_RENDER_PROBE && f < MET_RENDER_PROBE + PERF_PROBE_COUNT) {
+        int id = f - MET_RENDER_PROBE;
+        PerfTotals t;
+        perf_totals(id, t);
+        size_t len = 0;
+        for (int i = 0; i < PERF_LE_COUNT; i++) {
+          len = metrics_put(out, cap, len, "clock_render_seconds_bucket{probe=\"%s\",le=\"%.6f\"} %lu\n",
+                            PERF_NAMES[id], perf_le_us(i) / 1e6, (unsigned long)t.le[i]);
+        }
+        len = metrics_put(out, cap, len, "clock_render_seconds_bucket{probe=\"%s\",le=\"+Inf\"} %lu\n",
+                          PERF_NAMES[id], (unsigned long)t.count);
+        len = metrics_put(out, cap, len, "clock_render_seconds_sum{probe=\"%s\"} %.6f\n", PERF_NAMES[id], t.sum_us / 1e6);
+        return metrics_put(out, cap, len, "clock_render_seconds_count{probe=\"%s\"} %lu\n",
+                           PERF_NAMES[id], (unsigned long)t.count);
+      }
+      return 0;
+#else
+    default:
+      return 0;
+#endif
   }
-  
-  // Uptime
-  unsigned long up_sec = millis() / 1000;
-  unsigned long up_min = up_sec / 60;
-  unsigned long up_hr = up_min / 60;
-  unsigned long up_day = up_hr / 24;
-  
-  if (up_day > 0) {
-    snprintf(upbuf, sizeof(upbuf), "%lud %luh", up_day, up_hr % 24);
-  } else if (up_hr > 0) {
-    snprintf(upbuf, sizeof(upbuf), "%luh %lum", up_hr, up_min % 60);
+}
+
+void handle_metrics(AsyncWebServerRequest* request) {
+  // The lambda's only state is the family cursor, small enough for
+  // std::function to store inline
+  AsyncWebServerResponse* response = request->beginChunkedResponse("text/plain; version=0.0.4",
+      [family = 0](uint8_t* buffer, size_t max_len, size_t) mutable -> size_t {
+    char text[METRICS_FAMILY_MAX];
+    size_t written = 0;
+    while (family < MET_COUNT) {
+      size_t len = metrics_family(family, text, sizeof(text));
+      if (written + len > max_len) break;  // Whole families only - this one goes next time
+      memcpy(buffer + written, text, len);
+      written += len;
+      family++;
+    }
+    if (!written && family < MET_COUNT) return RESPONSE_TRY_AGAIN;  // Send buffer too full for a family
+    return written;  // 0 ends the response
+  });
+  request->send(response);
+}
+
+// ============================================================================
+// API HANDLERS
+// ============================================================================
+
+// Serve a pre-gzipped asset from flash. The ETag is the hash of the gzip
+// bytes, so a browser revalidating an unchanged page gets an empty 304.
+void send_gzip_asset(AsyncWebServerRequest* request, const char* type, const char* etag,
+                     const uint8_t* data, size_t len) {
+  AsyncWebServerResponse* response;
+  const AsyncWebHeader* match = request->getHeader("If-None-Match");
+  if (match && match->value() == etag) {
+    response = request->beginResponse(304);
   } else {
-    snprintf(upbuf, sizeof(upbuf), "%lum", up_min);
+    response = request->beginResponse(200, type, data, len);
+    response->addHeader("Content-Encoding", "gzip");
   }
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", "no-cache");  // Cache, but always revalidate
+  request->send(response);
+}
+
+void handle_root(AsyncWebServerRequest* request) {
+  send_gzip_asset(request, INDEX_HTML_TYPE, INDEX_HTML_ETAG, INDEX_HTML_GZ, INDEX_HTML_GZ_LEN);
+}
+
+void handle_status(AsyncWebServerRequest* request) {
+  StaticJsonDocument<1024> doc;
   
-  // Sunrise/sunset
-  snprintf(risebuf, sizeof(risebuf), "%02d:%02d", sunrise_time / 60, sunrise_time % 60);
-  snprintf(setbuf, sizeof(setbuf), "%02d:%02d", sunset_time / 60, sunset_time % 60);
+  LiveStatus live;
+  status_live_read(live);
+  status_live_json(doc, live, nullptr);
   
-  // Battery
-  float batt_v = amoled.getBattVoltage();
-  int batt_pct = (int)((batt_v - 3.0) / 1.2 * 100.0);
-  batt_pct = constrain(batt_pct, 0, 100);
+  doc["inv_px"] = inv_px_per_sec;
+  doc["reconn_ms"] = wifi_connect_ms;
+  doc["reconn_n"] = wifi_reconnect_count;
+  doc["lt_saved"] = clock_svc.saved_per_sec;
+  doc["phase_ms"] = tick_phase_err_ms;
+  doc["phase_worst_ms"] = tick_phase_worst_ms;
+  doc["i2c_txn_s"] = bq.txn_per_sec;
+  doc["i2c_bytes_s"] = bq.bytes_per_sec;
+  doc["chg_irq"] = charger_irq_count;
+  doc["chg_fault"] = charger_last_fault;
+  doc["sse_clients"] = status_events.count();
+  doc["sse_pushes"] = status_stream.pushes;
+  doc["cfg_apply_us"] = config_bus.last_apply_us;
+  doc["cfg_writes"] = config_writes;
+  doc["br_wakeups"] = brightness_wakeups;
+  doc["br_writes"] = brightness_writes;
+  doc["power"] = power.on_battery ? "battery" : "usb";
+  doc["pm"] = (bool)power.pm_available;
+  doc["dfs"] = (bool)power.dfs;
+  doc["light_sleep"] = (bool)power.light_sleep;
+  doc["awake_pct"] = power.awake_pct;
+  doc["est_ma"] = power_estimate_ma(panel_brightness);
+  doc["lp_face"] = ui_low_power;
+  doc["wake"] = night_wake_name();
+  doc["wake_ms"] = night.visible_ms;
+  doc["slept_s"] = (uint32_t)(night.slept_us / 1000000);
+  doc["rtc_drift_ms"] = -night.correction_ms;
+  doc["rtc_ppm"] = night.ppm;
   
-  doc["time"] = tbuf;
-  doc["batt"] = batt_pct;
-  doc["chrg"] = is_charging();
-  doc["rssi"] = WiFi.RSSI();
-  doc["up"] = upbuf;
-  doc["rise"] = risebuf;
-  doc["set"] = setbuf;
+  JsonObject ntp_doc = doc.createNestedObject("ntp");
+  ntp_doc["synced"] = (bool)time_synced;
+  if (ntp_stats.server >= 0) {
+    ntp_doc["server"] = NTP_SERVERS[ntp_stats.server];
+    ntp_doc["offset_ms"] = ntp_stats.offset_ms;
+    ntp_doc["rtt_ms"] = ntp_stats.rtt_ms;
+    ntp_doc["age_s"] = (millis() - ntp_stats.synced_at) / 1000;
+    ntp_doc["count"] = ntp_stats.count;
+  }
   
-  String json;
-  serializeJson(doc, json);
-  web_server.send(200, "application/json", json);
+  AsyncResponseStream* response = request->beginResponseStream("application/json");
+  serializeJson(doc, *response);
+  request->send(response);
 }
 
-void handle_get_config() {
+#if PERF_PROBES
+// Per-callback latency over the last minute, and the single worst sample
+void handle_perf(AsyncWebServerRequest* request) {
   StaticJsonDocument<1024> doc;
+  doc["window_s"] = PERF_SLICES * PERF_SLICE_MS / 1000;
+  doc["cpu_mhz"] = ESP.getCpuFreqMHz();
+  JsonObject probes = doc.createNestedObject("probes");
+  int worst = -1;
+  PerfSummary worst_s = {};
+  for (int i = 0; i < PERF_PROBE_COUNT; i++) {
+    PerfSummary s;
+    perf_summary(i, s);
+    JsonObject p = probes.createNestedObject(PERF_NAMES[i]);
+    p["n"] = s.count;
+    p["p50_us"] = s.p50_us;
+    p["p99_us"] = s.p99_us;
+    p["max_us"] = s.max_us;
+    if (s.count && s.max_us >= worst_s.max_us) {
+      worst = i;
+      worst_s = s;
+    }
+  }
+  if (worst >= 0) {
+    JsonObject w = doc.createNestedObject("worst");
+    w["probe"] = PERF_NAMES[worst];
+    w["us"] = worst_s.max_us;
+    w["age_s"] = worst_s.max_age_ms / 1000;
+  }
   
-  doc["show_sec"] = config.show_seconds;
-  doc["show_date"] = config.show_date;
-  doc["auto_br"] = config.auto_brightness;
-  doc["day_br"] = config.day_brightness;
-  doc["night_br"] = config.night_brightness;
-  doc["trans"] = config.transition_minutes;
-  doc["lat"] = config.latitude;
-  doc["lon"] = config.longitude;
-  doc["tz"] = config.timezone;
-  doc["ssid"] = config.wifi_ssid;
-  doc["wthr_en"] = config.weather_enabled;
-  doc["wthr_key"] = config.weather_api_key;
-  doc["color"] = config.color_scheme;
+  AsyncResponseStream* response = request->beginResponseStream("application/json");
+  serializeJson(doc, *response);
+  request->send(response);
+}
+#endif
+
+void handle_get_config(AsyncWebServerRequest* request) {
+  ClockConfig c;
+  config_snapshot(c);
+  StaticJsonDocument<1024> doc;
   
-  String json;
-  serializeJson(doc, json);
-  web_server.send(200, "application/json", json);
+  doc["show_sec"] = c.show_seconds;
+  doc["show_date"] = c.show_date;
+  doc["auto_br"] = c.auto_brightness;
+  doc["day_br"] = c.day_brightness;
+  doc["night_br"] = c.night_brightness;
+  doc["trans"] = c.transition_minutes;
+  doc["fade_touch"] = c.fade_ms[FADE_TOUCH];
+  doc["fade_cfg"] = c.fade_ms[FADE_CONFIG];
+  doc["fade_auto"] = c.fade_ms[FADE_AUTO];
+  doc["ease_touch"] = c.fade_ease[FADE_TOUCH];
+  doc["ease_cfg"] = c.fade_ease[FADE_CONFIG];
+  doc["ease_auto"] = c.fade_ease[FADE_AUTO];
+  doc["sleep_mode"] = c.sleep_mode;
+  doc["sleep_start"] = c.sleep_start;
+  doc["sleep_end"] = c.sleep_end;
+  doc["lat"] = c.latitude;
+  doc["lon"] = c.longitude;
+  doc["tz"] = c.timezone;
+  doc["ssid"] = c.wifi_ssid;
+  doc["wthr_en"] = c.weather_enabled;
+  doc["wthr_key"] = c.weather_api_key;
+  doc["color"] = c.color_scheme;
+  doc["face"] = c.clock_face;
+  doc["skew"] = c.segment_skew;
+  
+  AsyncResponseStream* response = request->beginResponseStream("application/json");
+  serializeJson(doc, *response);
+  request->send(response);
+}
+
+// The body arrives in TCP-sized pieces; collect it in the request's scratch
+// pointer, which the library frees along with the request
+const size_t CONFIG_BODY_MAX = 1024;
+
+void handle_post_config_body(AsyncWebServerRequest* request, uint8_t* data, size_t len,
+                             size_t index, size_t total) {
+  if (total > CONFIG_BODY_MAX) return;
+  if (index == 0) request->_tempObject = malloc(total + 1);
+  char* body = (char*)request->_tempObject;
+  if (!body) return;
+  memcpy(body + index, data, len);
+  if (index + len == total) body[total] = '\0';
 }
 
-void handle_post_config() {
-  if (!web_server.hasArg("plain")) {
-    web_server.send(400, "text/plain", "No data");
+void handle_post_config(AsyncWebServerRequest* request) {
+  const char* body = (const char*)request->_tempObject;
+  if (!body) {
+    request->send(400, "text/plain", "No data");
     return;
   }
   
   StaticJsonDocument<1024> doc;
-  DeserializationError err = deserializeJson(doc, web_server.arg("plain"));
+  DeserializationError err = deserializeJson(doc, body);
   
   if (err) {
-    web_server.send(400, "text/plain", "Invalid JSON");
+    request->send(400, "text/plain", "Invalid JSON");
     return;
   }
   
-  // Update config
-  config.show_seconds = doc["show_sec"] | config.show_seconds;
-  config.show_date = doc["show_date"] | config.show_date;
-  config.auto_brightness = doc["auto_br"] | config.auto_brightness;
-  config.day_brightness = doc["day_br"] | config.day_brightness;
-  config.night_brightness = doc["night_br"] | config.night_brightness;
-  config.transition_minutes = doc["trans"] | config.transition_minutes;
-  config.latitude = doc["lat"] | config.latitude;
-  config.longitude = doc["lon"] | config.longitude;
-  config.color_scheme = doc["color"] | config.color_scheme;
+  // Build the new config beside the live one; the net task swaps it in
+  ClockConfig current;
+  config_snapshot(current);
+  ClockConfig next = current;
+  next.show_seconds = doc["show_sec"] | next.show_seconds;
+  next.show_date = doc["show_date"] | next.show_date;
+  next.auto_brightness = doc["auto_br"] | next.auto_brightness;
+  next.day_brightness = doc["day_br"] | next.day_brightness;
+  next.night_brightness = doc["night_br"] | next.night_brightness;
+  next.transition_minutes = doc["trans"] | next.transition_minutes;
+  next.fade_ms[FADE_TOUCH] = constrain(doc["fade_touch"] | (int)next.fade_ms[FADE_TOUCH], 0, 10000);
+  next.fade_ms[FADE_CONFIG] = constrain(doc["fade_cfg"] | (int)next.fade_ms[FADE_CONFIG], 0, 10000);
+  next.fade_ms[FADE_AUTO] = constrain(doc["fade_auto"] | (int)next.fade_ms[FADE_AUTO], 0, 10000);
+  next.fade_ease[FADE_TOUCH] = constrain(doc["ease_touch"] | (int)next.fade_ease[FADE_TOUCH], 0, EASE_COUNT - 1);
+  next.fade_ease[FADE_CONFIG] = constrain(doc["ease_cfg"] | (int)next.fade_ease[FADE_CONFIG], 0, EASE_COUNT - 1);
+  next.fade_ease[FADE_AUTO] = constrain(doc["ease_auto"] | (int)next.fade_ease[FADE_AUTO], 0, EASE_COUNT - 1);
+  next.sleep_mode = constrain(doc["sleep_mode"] | (int)next.sleep_mode, SLEEP_OFF, SLEEP_SUN);
+  next.sleep_start = constrain(doc["sleep_start"] | (int)next.sleep_start, 0, 1439);
+  next.sleep_end = constrain(doc["sleep_end"] | (int)next.sleep_end, 0, 1439);
+  next.latitude = doc["lat"] | next.latitude;
+  next.longitude = doc["lon"] | next.longitude;
+  next.color_scheme = constrain(doc["color"] | (int)next.color_scheme, 0, COLOR_SCHEME_COUNT - 1);
+  next.clock_face = constrain(doc["face"] | (int)next.clock_face, FACE_FONT, FACE_SEGMENT);
+  next.segment_skew = constrain(doc["skew"] | (int)next.segment_skew, 0, SEGMENT_SKEW_MAX);
   
   if (doc.containsKey("tz")) {
-    strlcpy(config.timezone, doc["tz"], sizeof(config.timezone));
+    strlcpy(next.timezone, doc["tz"], sizeof(next.timezone));
   }
   if (doc.containsKey("ssid")) {
-    strlcpy(config.wifi_ssid, doc["ssid"], sizeof(config.wifi_ssid));
+    strlcpy(next.wifi_ssid, doc["ssid"], sizeof(next.wifi_ssid));
   }
   if (doc.containsKey("pass") && strlen(doc["pass"]) > 0) {
-    strlcpy(config.wifi_pass, doc["pass"], sizeof(config.wifi_pass));
+    strlcpy(next.wifi_pass, doc["pass"], sizeof(next.wifi_pass));
   }
   if (doc.containsKey("wthr_key")) {
-    strlcpy(config.weather_api_key, doc["wthr_key"], sizeof(config.weather_api_key));
+    strlcpy(next.weather_api_key, doc["wthr_key"], sizeof(next.weather_api_key));
   }
   
-  config.weather_enabled = doc["wthr_en"] | config.weather_enabled;
+  next.weather_enabled = doc["wthr_en"] | next.weather_enabled;
   
-  save_config();
+  uint32_t changed = config_diff(current, next);
+  if (changed && !config_submit(next)) {
+    request->send(503, "text/plain", "Busy - try again");
+    return;
+  }
   
-  web_server.send(200, "text/plain", "OK");
+  request->send(200, "text/plain", (changed & CFG_WIFI) ? "Applied - WiFi reconnecting" : "Applied");
 }
 
-void handle_restart() {
-  web_server.send(200, "text/plain", "Restarting...");
-  delay(500);
-  ESP.restart();
+// The reboot happens on the net task once the reply has had time to go out
+void handle_restart(AsyncWebServerRequest* request) {
+  request->send(200, "text/plain", "Restarting...");
+  web_restart_at = millis() + 500;
 }
 
 // ============================================================================
@@ -413,9 +750,20 @@ void setup_web_server() {
   // Register handlers
   web_server.on("/", HTTP_GET, handle_root);
   web_server.on("/api/status", HTTP_GET, handle_status);
+  web_server.on("/metrics", HTTP_GET, handle_metrics);
+#if PERF_PROBES
+  web_server.on("/api/perf", HTTP_GET, handle_perf);
+#endif
   web_server.on("/api/config", HTTP_GET, handle_get_config);
-  web_server.on("/api/config", HTTP_POST, handle_post_config);
+  web_server.on("/api/config", HTTP_POST, handle_post_config, nullptr, handle_post_config_body);
   web_server.on("/api/restart", HTTP_POST, handle_restart);
+  ota_token_begin();
+  web_server.on("/api/update", HTTP_POST, handle_update, handle_update_upload);
+  status_events.onConnect(status_stream_connect);
+  web_server.addHandler(&status_events);
+  web_server.onNotFound([](AsyncWebServerRequest* request) {
+    request->send(404, "text/plain", "Not found");
+  });
   
   // Start server
   web_server.begin();
@@ -424,9 +772,13 @@ void setup_web_server() {
                 WiFi.localIP().toString().c_str());
 }
 
-// Call this from loop()
+// Call this from the net task - requests themselves are served by AsyncTCP
 void handle_web_server() {
-  web_server.handleClient();
+  {
+    PERF_SCOPE(PERF_STATUS_STREAM);
+    status_stream_tick();
+  }
+  if (web_restart_at && (int32_t)(millis() - web_restart_at) >= 0) ESP.restart();
 }
 
 #endif // WEB_INTERFACE_H
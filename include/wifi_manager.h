@@ -0,0 +1,175 @@
+// ============================================================================
+// WIFI MANAGER - Event-driven, non-blocking connection state machine
+//
+// The ESP32 WiFi events drive the state; wifi_manager_poll() only checks
+// timers, so it never blocks the task that calls it. The last AP's BSSID and
+// channel are cached in NVS so reconnects can skip the full channel scan.
+// Failed attempts back off exponentially (1s, 2s, 4s ... 60s).
+//
+// Include this file in main.cpp and call wifi_manager_poll() from the net task.
+// ============================================================================
+
+#ifndef WIFI_MANAGER_H
+#define WIFI_MANAGER_H
+
+#include <WiFi.h>
+#include <Preferences.h>
+
+enum WifiState : uint8_t { WIFI_IDLE, WIFI_CONNECTING, WIFI_CONNECTED, WIFI_BACKOFF };
+const char* const WIFI_STATE_NAMES[] = {"idle", "connecting", "connected", "backoff"};
+
+const uint32_t WIFI_CONNECT_TIMEOUT_MS = 15000;
+const uint32_t WIFI_BACKOFF_MIN_MS = 1000;
+const uint32_t WIFI_BACKOFF_MAX_MS = 60000;
+
+// Polled by the UI and web API - written only by the event callback / net task
+volatile uint8_t wifi_state = WIFI_IDLE;
+volatile uint32_t wifi_connect_ms = 0;     // Last attempt-start to got-IP time
+volatile uint32_t wifi_reconnect_count = 0;
+
+struct WifiManager {
+  uint32_t attempt_start = 0;
+  uint32_t next_attempt = 0;
+  uint32_t backoff_ms = WIFI_BACKOFF_MIN_MS;
+  bool fast_attempt = false;       // Current attempt used the cached BSSID/channel
+  volatile bool got_ip = false;    // Set by the event callback, consumed by poll
+  volatile bool dropped = false;
+  uint8_t bssid[6] = {0};
+  uint8_t channel = 0;             // 0 = nothing cached, do a full scan
+  volatile bool ap_changed = false;
+};
+WifiManager wifi_mgr;
+
+void wifi_load_ap_cache() {
+  Preferences p;
+  p.begin("wifi", true);
+  wifi_mgr.channel = p.getUChar("chan", 0);
+  if (p.getBytes("bssid", wifi_mgr.bssid, sizeof(wifi_mgr.bssid)) != sizeof(wifi_mgr.bssid)) {
+    wifi_mgr.channel = 0;
+  }
+  p.end();
+}
+
+void wifi_save_ap_cache() {
+  Preferences p;
+  p.begin("wifi", false);
+  p.putBytes("bssid", wifi_mgr.bssid, sizeof(wifi_mgr.bssid));
+  p.putUChar("chan", wifi_mgr.channel);
+  p.end();
+  Serial.printf("📡 Cached AP on channel %d\n", wifi_mgr.channel);
+}
+
+// Runs on the WiFi event task - only flips flags, the net task does the rest
+void wifi_event_cb(arduino_event_id_t event, arduino_event_info_t info) {
+  switch (event) {
+    case ARDUINO_EVENT_WIFI_STA_CONNECTED: {
+      const uint8_t* b = info.wifi_sta_connected.bssid;
+      if (memcmp(b, wifi_mgr.bssid, 6) != 0 || info.wifi_sta_connected.channel != wifi_mgr.channel) {
+        memcpy(wifi_mgr.bssid, b, 6);
+        wifi_mgr.channel = info.wifi_sta_connected.channel;
+        wifi_mgr.ap_changed = true;
+      }
+      break;
+    }
+    case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+      wifi_mgr.got_ip = true;
+      break;
+    case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+    case ARDUINO_EVENT_WIFI_STA_LOST_IP:
+      wifi_mgr.dropped = true;
+      break;
+    default:
+      break;
+  }
+}
+
+void wifi_start_attempt() {
+  uint32_t now = millis();
+  wifi_mgr.attempt_start = now;
+  wifi_mgr.got_ip = false;
+  wifi_mgr.dropped = false;
+  wifi_mgr.fast_attempt = wifi_mgr.channel != 0;
+  if (wifi_mgr.fast_attempt) {
+    Serial.printf("📡 Connecting to %s (cached channel %d)...\n", config.wifi_ssid, wifi_mgr.channel);
+    WiFi.begin(config.wifi_ssid, config.wifi_pass, wifi_mgr.channel, wifi_mgr.bssid, true);
+  } else {
+    Serial.printf("📡 Connecting to %s...\n", config.wifi_ssid);
+    WiFi.begin(config.wifi_ssid, config.wifi_pass);
+  }
+  wifi_state = WIFI_CONNECTING;
+}
+
+void wifi_schedule_retry() {
+  WiFi.disconnect();
+  if (wifi_mgr.fast_attempt) {
+    // Cached AP did not answer - retry straight away with a full scan
+    wifi_mgr.channel = 0;
+    wifi_mgr.next_attempt = millis();
+  } else {
+    wifi_mgr.next_attempt = millis() + wifi_mgr.backoff_ms;
+    Serial.printf("✗ WiFi failed, retry in %lus\n", (unsigned long)(wifi_mgr.backoff_ms / 1000));
+    wifi_mgr.backoff_ms = min(wifi_mgr.backoff_ms * 2, WIFI_BACKOFF_MAX_MS);
+  }
+  wifi_state = WIFI_BACKOFF;
+}
+
+void wifi_manager_begin() {
+  wifi_load_ap_cache();
+  WiFi.mode(WIFI_STA);
+  WiFi.setSleep(true);           // Modem sleep - light sleep on battery depends on it
+  WiFi.setAutoReconnect(false);  // Reconnects are driven by the state machine
+  WiFi.onEvent(wifi_event_cb);
+  wifi_start_attempt();
+}
+
+// Drop the current connection and reconnect with the current credentials
+void wifi_manager_restart() {
+  WiFi.disconnect();
+  wifi_mgr.channel = 0;
+  wifi_mgr.backoff_ms = WIFI_BACKOFF_MIN_MS;
+  wifi_start_attempt();
+}
+
+// Advance the state machine. Returns true once each time a connection comes up.
+bool wifi_manager_poll() {
+  uint32_t now = millis();
+  switch (wifi_state) {
+    case WIFI_CONNECTING:
+      if (wifi_mgr.got_ip) {
+        wifi_connect_ms = now - wifi_mgr.attempt_start;
+        wifi_mgr.backoff_ms = WIFI_BACKOFF_MIN_MS;
+        wifi_mgr.dropped = false;
+        wifi_state = WIFI_CONNECTED;
+        if (wifi_mgr.ap_changed) {
+          wifi_mgr.ap_changed = false;
+          wifi_save_ap_cache();
+        }
+        Serial.printf("✓ Connected in %lums! IP: %s\n", (unsigned long)wifi_connect_ms,
+                      WiFi.localIP().toString().c_str());
+        return true;
+      }
+      // Only the timeout ends an attempt - stray disconnect events during association are normal
+      if (now - wifi_mgr.attempt_start >= WIFI_CONNECT_TIMEOUT_MS) {
+        wifi_schedule_retry();
+      }
+      break;
+
+    case WIFI_CONNECTED:
+      if (wifi_mgr.dropped) {
+        Serial.println("📡 WiFi lost, reconnecting...");
+        wifi_reconnect_count++;
+        wifi_start_attempt();
+      }
+      break;
+
+    case WIFI_BACKOFF:
+      if ((int32_t)(now - wifi_mgr.next_attempt) >= 0) wifi_start_attempt();
+      break;
+
+    default:
+      break;
+  }
+  return false;
+}
+
+#endif // WIFI_MANAGER_H
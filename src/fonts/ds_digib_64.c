@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 64 px
  * Bpp: 4
- * Opts: --font ./ds_digital/DS-DIGIB.TTF --size 64 --bpp 4 --format lvgl --no-compress --range 0x20-0x3A --output ./src/fonts/ds_digib_64.c
+ * Opts: --font ./ds_digital/DS-DIGIB.TTF --size 64 --bpp 4 --format lvgl --no-compress --range 0x20,0x2D,0x30-0x3A --output ./src/fonts/ds_digib_64.c
  ******************************************************************************/
 
 #ifdef LV_LVGL_H_INCLUDE_SIMPLE
@@ -24,641 +24,6 @@
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
-    /* U+0021 "!" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x82, 0x0,
-    0x0, 0x8f, 0x20, 0x0, 0x8f, 0xf2, 0x0, 0x7f,
-    0xff, 0x20, 0x7f, 0xff, 0xf2, 0x7f, 0xff, 0xff,
-    0x2e, 0xff, 0xff, 0xf2, 0xef, 0xff, 0xff, 0x2e,
-    0xff, 0xff, 0xf2, 0xef, 0xff, 0xff, 0x2e, 0xff,
-    0xff, 0xf2, 0xef, 0xff, 0xff, 0x2e, 0xff, 0xff,
-    0xf2, 0xef, 0xff, 0xff, 0x2e, 0xff, 0xff, 0xf2,
-    0xaf, 0xff, 0xff, 0x20, 0xbf, 0xff, 0xf2, 0x0,
-    0xbf, 0xf8, 0x0, 0x0, 0xb8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x10,
-    0x0, 0x3, 0xed, 0x10, 0x3, 0xef, 0xfd, 0x3,
-    0xef, 0xff, 0xf2, 0xdf, 0xff, 0xff, 0x2e, 0xff,
-    0xff, 0xf2, 0xef, 0xff, 0xff, 0x2e, 0xff, 0xff,
-    0xf2, 0xef, 0xff, 0xff, 0x2e, 0xff, 0xff, 0xf2,
-    0xef, 0xff, 0xff, 0x2e, 0xff, 0xff, 0xf2, 0xef,
-    0xff, 0xff, 0x2d, 0xff, 0xff, 0xf2, 0x2e, 0xff,
-    0xff, 0x20, 0x2e, 0xff, 0xf2, 0x0, 0x3e, 0xff,
-    0x20, 0x0, 0x3e, 0xf2, 0x0, 0x0, 0x3e, 0x20,
-    0x0, 0x0, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x67, 0x77, 0x77, 0x1e, 0xff, 0xff,
-    0xf2, 0xef, 0xff, 0xff, 0x2e, 0xff, 0xff, 0xf2,
-    0xef, 0xff, 0xff, 0x2e, 0xff, 0xff, 0xf2,
-
-    /* U+0022 "\"" */
-    0x4f, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xf0,
-    0x4f, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xf0,
-    0x4f, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xf0,
-    0x4f, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xf0,
-    0x4f, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xf0,
-    0x4f, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xf0,
-    0x4f, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xf0,
-    0x4f, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xf0,
-    0x1d, 0xff, 0xff, 0x60, 0xb, 0xff, 0xff, 0xa0,
-    0x1, 0xdf, 0xf7, 0x0, 0x0, 0xbf, 0xfb, 0x0,
-    0x0, 0x1d, 0x70, 0x0, 0x0, 0xb, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x2, 0xed, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xc0,
-    0x0, 0x0, 0x2, 0xef, 0xfc, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xb0, 0x0, 0x1, 0xef, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xe0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x11,
-    0x7, 0xff, 0xfe, 0x20, 0x11, 0x10, 0x6f, 0xff,
-    0xf3, 0x1, 0x11, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf4, 0x7, 0xfe, 0x20, 0x9f, 0xff, 0x50, 0x6f,
-    0xf3, 0x8, 0xff, 0xfc, 0x10, 0x0, 0x3f, 0xff,
-    0xff, 0xf4, 0x7, 0x20, 0x9f, 0xff, 0xff, 0x50,
-    0x63, 0x8, 0xff, 0xff, 0xfc, 0x10, 0x3f, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x40, 0x8, 0xff, 0xff, 0xff, 0xfc, 0x2, 0xef,
-    0xff, 0xff, 0xfe, 0x30, 0x8, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xb0, 0x2,
-    0xef, 0xff, 0xff, 0x30, 0x94, 0x8, 0xff, 0xff,
-    0xf3, 0x8, 0x50, 0x7f, 0xff, 0xff, 0xb0, 0x0,
-    0x2, 0xef, 0xff, 0x30, 0xaf, 0xf4, 0x8, 0xff,
-    0xf4, 0x9, 0xff, 0x50, 0x7f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf5, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xd0,
-    0x0, 0x2, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xd0, 0x0, 0x2, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x11, 0x10, 0x9f, 0xff,
-    0xf4, 0x1, 0x11, 0x8, 0xff, 0xff, 0x40, 0x11,
-    0x10, 0x0, 0x0, 0x3, 0xff, 0xff, 0x40, 0x9f,
-    0xf3, 0x9, 0xff, 0xf5, 0x7, 0xff, 0x40, 0x8f,
-    0xff, 0xc1, 0x0, 0x3, 0xff, 0xff, 0xff, 0x40,
-    0x83, 0x9, 0xff, 0xff, 0xf5, 0x7, 0x40, 0x8f,
-    0xff, 0xff, 0xc1, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x9, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xc0, 0x2e, 0xff, 0xff, 0xff,
-    0xe3, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x30, 0x7,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x2e, 0xff, 0xff,
-    0xf3, 0x8, 0x30, 0x8f, 0xff, 0xff, 0x30, 0x74,
-    0x7, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x2e, 0xff,
-    0xf3, 0x9, 0xff, 0x30, 0x8f, 0xff, 0x40, 0x7f,
-    0xf4, 0x7, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x30, 0x0, 0x0, 0x8f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x3,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0,
-    0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x7f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x7f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x64, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x88, 0x88, 0x85, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x18, 0x2,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x1c, 0xfa, 0x2, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x1d, 0xff, 0xfa, 0x1, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x20, 0x0, 0x9, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xe2, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0xa2, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x63, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x6f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x5f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x2e, 0xff, 0xf5, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x3e, 0xf6, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x36, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x2e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x88, 0x88, 0x85, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0x8a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x26, 0xbf, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x80, 0x2e, 0xff, 0xff, 0xf7, 0x4,
-    0x40, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x2e,
-    0xff, 0xf7, 0x4, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x90, 0x12, 0x22, 0x3, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x6f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0x60, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0xe, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x8, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf9, 0x1, 0x22, 0x10, 0x3f, 0xff,
-    0xe3, 0x0, 0xef, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x2, 0xef,
-    0xff, 0x70, 0x3f, 0xe3, 0x0, 0xb, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x2, 0xef, 0xff, 0xff, 0x70, 0x32, 0x0,
-    0x0, 0x7f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x3, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x65, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x32, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x6a, 0xef, 0x70, 0x0,
-    0x0, 0x0, 0x22, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0xa3, 0x8, 0xff, 0xff, 0xf9, 0x3, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0xbf, 0xf3, 0x8, 0xff,
-    0xf9, 0x3, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xf4, 0x0, 0xaf,
-    0xff, 0xf3, 0x0, 0x0, 0x3, 0xef, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xfa, 0x0, 0x4f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0x20, 0x4, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x4f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x4, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xe2, 0x1,
-    0x11, 0x2, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x8f, 0xd1, 0xa, 0xff, 0xfa, 0x1, 0xdf, 0x80,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x61, 0xa, 0xff, 0xff,
-    0xfa, 0x1, 0x60, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0xa0, 0x2e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xff, 0xfa, 0x1, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8b, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xaf, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x8f, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0xb, 0xfe, 0x20, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x8f, 0xf4, 0x6, 0x80, 0x0,
-    0x0, 0xa2, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x8, 0x50, 0x6f, 0xf8, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x6, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x8, 0xff, 0xff, 0xa0,
-    0x0, 0x81, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x6, 0x30, 0x8f, 0xfa, 0x0,
-    0x9, 0xfd, 0x10, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x6f, 0xf3, 0x8, 0xa0, 0x0,
-    0x7f, 0xff, 0xc0, 0x1, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x5, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0xaf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0xc, 0xff, 0xf9, 0x0, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0x2e, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xa0, 0x1d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x3, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x36, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0027 "'" */
-    0x4f, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xfc, 0x4f,
-    0xff, 0xff, 0xc4, 0xff, 0xff, 0xfc, 0x4f, 0xff,
-    0xff, 0xc4, 0xff, 0xff, 0xfc, 0x4f, 0xff, 0xff,
-    0xc4, 0xff, 0xff, 0xfc, 0x1d, 0xff, 0xff, 0x60,
-    0x1d, 0xff, 0x70, 0x0, 0x1d, 0x70, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0028 "(" */
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x7, 0x20, 0xaf, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x8, 0xfe, 0x20, 0xaf, 0xff,
-    0x40, 0x0, 0x0, 0x8, 0xff, 0xfe, 0x20, 0x22,
-    0x10, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcc, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xfe, 0x20, 0x11, 0x10, 0x0,
-    0x0, 0x0, 0x8, 0xfe, 0x20, 0xaf, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x7, 0x20, 0xaf, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0x40,
-
-    /* U+0029 ")" */
-    0x3f, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0,
-    0x18, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xc0,
-    0x1d, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x12, 0x20,
-    0x1d, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x1, 0x10, 0x1d, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xb0, 0x1d,
-    0xfa, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xb0,
-    0x18, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xc2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x49, 0x50, 0x0, 0x7, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x49, 0x51, 0x0, 0x1c, 0xff, 0xff, 0xc3,
-    0x0, 0x7f, 0xff, 0xff, 0x90, 0x4, 0xcf, 0xff,
-    0xfc, 0x30, 0xff, 0xff, 0xff, 0xfa, 0x2, 0xff,
-    0xff, 0xf3, 0xb, 0xff, 0xff, 0xff, 0xf1, 0xb,
-    0xff, 0xff, 0xff, 0xf7, 0x9, 0xff, 0xfa, 0x7,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xf1, 0x1f, 0xff, 0x21, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x2, 0xef, 0xff, 0xff, 0xff, 0xa0,
-    0x7f, 0x90, 0x9f, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0x40, 0xd1, 0x3f,
-    0xff, 0xff, 0xff, 0xa2, 0x0, 0x0, 0x0, 0x1a,
-    0xff, 0xff, 0xfd, 0x1, 0xc, 0xff, 0xff, 0xfc,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0x77, 0x77, 0x73, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xaf, 0xff, 0xff, 0xd0, 0x10, 0x7f, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xf4, 0xd, 0x10, 0xef, 0xff, 0xff, 0xfd, 0x30,
-    0x0, 0x2e, 0xff, 0xff, 0xff, 0xfb, 0x7, 0xf9,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0x40, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0xef, 0xf2, 0xc, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0x70, 0x8f, 0xff, 0xb0, 0x3f, 0xff, 0xff, 0xff,
-    0xd0, 0xf, 0xff, 0xff, 0xff, 0xb0, 0x1f, 0xff,
-    0xff, 0x40, 0x5e, 0xff, 0xff, 0xff, 0x11, 0xcf,
-    0xff, 0xfc, 0x40, 0x7, 0xff, 0xff, 0xf9, 0x0,
-    0x19, 0xff, 0xff, 0xc3, 0x0, 0x4, 0x95, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xa0, 0x0, 0x3, 0x95,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2c, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xde, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
-    0x11, 0x10, 0x4f, 0xff, 0xf5, 0x1, 0x11, 0x11,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf7, 0x4,
-    0xff, 0x60, 0x6f, 0xff, 0xff, 0xd1, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0x70, 0x46, 0x6, 0xff,
-    0xff, 0xff, 0xfd, 0x10, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xd1, 0xb, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0x60, 0x56, 0x5, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf6,
-    0x5, 0xff, 0x60, 0x5f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+002C "," */
-    0x4f, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xfc, 0x4f,
-    0xff, 0xff, 0xc4, 0xff, 0xff, 0xfc, 0x4f, 0xff,
-    0xff, 0xc4, 0xff, 0xff, 0xfc, 0x4f, 0xff, 0xff,
-    0xc4, 0xff, 0xff, 0xfc, 0x1d, 0xff, 0xff, 0x60,
-    0x1d, 0xff, 0x70, 0x0, 0x1d, 0x70, 0x0, 0x0,
-    0x0, 0x0,
-
     /* U+002D "-" */
     0x0, 0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
     0x11, 0x11, 0x11, 0x0, 0x0, 0x0, 0xc, 0xff,
@@ -673,103 +38,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
     0xff, 0xc0, 0x0,
 
-    /* U+002E "." */
-    0x1, 0x11, 0x11, 0x14, 0xff, 0xff, 0xfc, 0x4f,
-    0xff, 0xff, 0xc4, 0xff, 0xff, 0xfc, 0x4f, 0xff,
-    0xff, 0xc4, 0xff, 0xff, 0xfc, 0x4f, 0xff, 0xff,
-    0xc0,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x7b, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x7b, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x32,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x37, 0xbf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x93, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
     /* U+0030 "0" */
     0x1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
     0xff, 0xff, 0xff, 0xff, 0x80, 0x5, 0x1, 0xdf,
@@ -1455,45 +723,37 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 242, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 292, .box_w = 7, .box_h = 50, .ofs_x = 6, .ofs_y = -8},
-    {.bitmap_index = 175, .adv_w = 317, .box_w = 16, .box_h = 12, .ofs_x = 2, .ofs_y = 29},
-    {.bitmap_index = 271, .adv_w = 619, .box_w = 33, .box_h = 36, .ofs_x = 3, .ofs_y = 1},
-    {.bitmap_index = 865, .adv_w = 521, .box_w = 27, .box_h = 61, .ofs_x = 3, .ofs_y = -10},
-    {.bitmap_index = 1689, .adv_w = 716, .box_w = 39, .box_h = 49, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 2645, .adv_w = 557, .box_w = 32, .box_h = 41, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 3301, .adv_w = 184, .box_w = 7, .box_h = 12, .ofs_x = 2, .ofs_y = 29},
-    {.bitmap_index = 3343, .adv_w = 321, .box_w = 17, .box_h = 41, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3692, .adv_w = 321, .box_w = 17, .box_h = 41, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4041, .adv_w = 498, .box_w = 27, .box_h = 32, .ofs_x = 2, .ofs_y = 10},
-    {.bitmap_index = 4473, .adv_w = 481, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = 7},
-    {.bitmap_index = 4811, .adv_w = 184, .box_w = 7, .box_h = 12, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 4853, .adv_w = 481, .box_w = 26, .box_h = 7, .ofs_x = 2, .ofs_y = 17},
-    {.bitmap_index = 4944, .adv_w = 184, .box_w = 7, .box_h = 7, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4969, .adv_w = 502, .box_w = 30, .box_h = 47, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 5674, .adv_w = 521, .box_w = 27, .box_h = 41, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6228, .adv_w = 292, .box_w = 7, .box_h = 39, .ofs_x = 6, .ofs_y = 1},
-    {.bitmap_index = 6365, .adv_w = 521, .box_w = 27, .box_h = 41, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6919, .adv_w = 521, .box_w = 26, .box_h = 41, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 7452, .adv_w = 521, .box_w = 27, .box_h = 40, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7992, .adv_w = 521, .box_w = 27, .box_h = 41, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 8546, .adv_w = 521, .box_w = 27, .box_h = 41, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 9100, .adv_w = 521, .box_w = 26, .box_h = 40, .ofs_x = 4, .ofs_y = 1},
-    {.bitmap_index = 9620, .adv_w = 521, .box_w = 27, .box_h = 41, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 10174, .adv_w = 521, .box_w = 27, .box_h = 41, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 10728, .adv_w = 227, .box_w = 7, .box_h = 35, .ofs_x = 4, .ofs_y = 0}
+    {.bitmap_index = 0, .adv_w = 481, .box_w = 26, .box_h = 7, .ofs_x = 2, .ofs_y = 17},
+    {.bitmap_index = 91, .adv_w = 521, .box_w = 27, .box_h = 41, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 645, .adv_w = 292, .box_w = 7, .box_h = 39, .ofs_x = 6, .ofs_y = 1},
+    {.bitmap_index = 782, .adv_w = 521, .box_w = 27, .box_h = 41, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 1336, .adv_w = 521, .box_w = 26, .box_h = 41, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 1869, .adv_w = 521, .box_w = 27, .box_h = 40, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 2409, .adv_w = 521, .box_w = 27, .box_h = 41, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 2963, .adv_w = 521, .box_w = 27, .box_h = 41, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 3517, .adv_w = 521, .box_w = 26, .box_h = 40, .ofs_x = 4, .ofs_y = 1},
+    {.bitmap_index = 4037, .adv_w = 521, .box_w = 27, .box_h = 41, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4591, .adv_w = 521, .box_w = 27, .box_h = 41, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5145, .adv_w = 227, .box_w = 7, .box_h = 35, .ofs_x = 4, .ofs_y = 0}
 };
 
 /*---------------------
  *  CHARACTER MAPPING
  *--------------------*/
 
-
+static const uint16_t unicode_list_0[] = {
+    0x0, 0xd
+};
 
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
     {
-        .range_start = 32, .range_length = 27, .glyph_id_start = 1,
+        .range_start = 32, .range_length = 14, .glyph_id_start = 1,
+        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    },
+    {
+        .range_start = 48, .range_length = 11, .glyph_id_start = 3,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     }
 };
@@ -1519,7 +779,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmaps = cmaps,
     .kern_dsc = NULL,
     .kern_scale = 0,
-    .cmap_num = 1,
+    .cmap_num = 2,
     .bpp = 4,
     .kern_classes = 0,
     .bitmap_format = 0,
@@ -1542,8 +802,8 @@ lv_font_t ds_digib_64 = {
 #endif
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
     .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 61,          /*The maximum line height required by the font*/
-    .base_line = 10,             /*Baseline measured from the bottom of the line*/
+    .line_height = 41,          /*The maximum line height required by the font*/
+    .base_line = 0,             /*Baseline measured from the bottom of the line*/
 #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
     .subpx = LV_FONT_SUBPX_NONE,
 #endif
@@ -25,55 +25,57 @@
 #include <LV_Helper.h>
 #include <Wire.h>
 #include <math.h>
+#include "msg_queue.h"
+#include "perf_probe.h"
 
 // ============================================================================
 // CONFIGURATION STRUCTURE - Now stored in NVS!
 // ============================================================================
 
-struct ClockConfig {
-  // Display
-  bool show_seconds = true;
-  bool show_date = true;
-  uint8_t color_scheme = 0; // 0=Red,1=Green,2=Blue,3=White,4=Amber
-  
-  // Brightness
-  bool auto_brightness = true;
-  uint8_t day_brightness = 200;
-  uint8_t night_brightness = 40;
-  uint8_t transition_minutes = 30;
-  
-  // Location (default: San Francisco, CA - update for your location)
-  float latitude = 37.7749;
-  float longitude = -122.4194;
-  char timezone[64] = "PST8PDT,M3.2.0/2,M11.1.0/2";
-  
-  // WiFi
-  char wifi_ssid[32] = "YOUR_WIFI_SSID";
-  char wifi_pass[64] = "YOUR_WIFI_PASSWORD";
-  
-  // Weather (optional)
-  bool weather_enabled = false;
-  char weather_api_key[64] = "";
-};
+#include "clock_config.h"
 
 ClockConfig config;
 Preferences prefs;
 
+enum ClockFace : uint8_t { FACE_FONT = 0, FACE_SEGMENT = 1 };
+static_assert(FACE_SEGMENT + 1 == CLOCK_FACE_COUNT, "CLOCK_FACE_COUNT out of date");
+
 // ============================================================================
 // GLOBALS
 // ============================================================================
 
 LilyGo_Class amoled;
-static const uint8_t BQ = 0x6B;
 
 // UI elements
-lv_obj_t *row_time = nullptr;
-lv_obj_t *lbl_hr = nullptr, *lbl_col1 = nullptr;
-lv_obj_t *lbl_min = nullptr, *lbl_col2 = nullptr;
-lv_obj_t *lbl_secA = nullptr;
+lv_obj_t *row_time = nullptr;  // Holds the time slots (digit_sprites.h / seven_segment.h)
+uint8_t active_face = FACE_FONT; // Face the time row was built with
+const lv_coord_t SEGMENT_HEIGHT = 90; // Vector face digit height - fits "12:34:56 P" in 536px
 lv_obj_t *date_label = nullptr;
 lv_obj_t *status_label = nullptr;
 
+// Dirty-field tracking - last text pushed to each field, so update_display()
+// only invalidates (and re-rasterizes) fields whose text actually changed
+enum DisplayField { FIELD_HOUR, FIELD_MINUTE, FIELD_COLON, FIELD_SECONDS, FIELD_AMPM,
+                    FIELD_DATE, FIELD_STATUS, FIELD_COUNT };
+char field_text[FIELD_COUNT][64];
+uint32_t inv_px_accum = 0;       // Invalidated area in the current window
+uint32_t inv_px_per_sec = 0;     // Invalidated area over the last full second
+uint32_t inv_px_window_start = 0;
+
+// Display tick is phase-locked to the RTC second: it fires TICK_LEAD_MS after
+// each boundary instead of on a free-running 1000ms period
+const int32_t TICK_LEAD_MS = 5;
+int32_t tick_phase_err_ms = 0;     // Last measured firing error vs. boundary + lead
+int32_t tick_phase_worst_ms = 0;   // Largest |error| over the last minute of ticks
+lv_timer_t* display_timer = nullptr;
+bool display_tick_forced = false;  // Off-schedule repaint (config change) - not a phase sample
+
+// Low-power face (on battery): hours and minutes only, repainted once a
+// minute, with the panel scanning just the time row
+bool ui_low_power = false;
+lv_area_t panel_window = {0, 0, -1, -1};   // Partial area last sent, empty = normal mode
+const uint32_t LOW_POWER_TOUCH_MS = 100;   // Touch poll period while in low power
+
 // Color palettes [bright, dim]
 const lv_color_t COLORS[][2] = {
   {lv_color_hex(0xFF2A2A), lv_color_hex(0xCC2424)}, // Red
@@ -82,6 +84,7 @@ const lv_color_t COLORS[][2] = {
   {lv_color_hex(0xFFFFFF), lv_color_hex(0xCCCCCC)}, // White
   {lv_color_hex(0xFFAA00), lv_color_hex(0xCC8800)}, // Amber
 };
+static_assert(sizeof(COLORS) / sizeof(COLORS[0]) == COLOR_SCHEME_COUNT, "COLOR_SCHEME_COUNT out of date");
 
 // State
 int sunrise_time = 0, sunset_time = 0;
@@ -89,14 +92,60 @@ uint8_t current_brightness = 200;
 uint8_t target_brightness = 200;
 int brightness_mode = 0; // 0=auto, 1=full, 2=dim, 3=medium
 const uint8_t manual_levels[] = {0, 255, 40, 128};
+uint8_t panel_brightness = 0;            // Last level actually sent to the panel
+lv_timer_t* brightness_timer = nullptr;  // Sleeps until the next target change
+const uint32_t BRIGHTNESS_IDLE_MS = 3600000; // Nothing scheduled (manual / fixed level)
+uint32_t brightness_wakeups = 0;
+uint32_t brightness_writes = 0;
 float battery_voltage = 0.0;
 float smoothed_voltage = 0.0;  // Smoothed battery voltage (EMA filter)
 
-// Battery float voltage management
-// REG06[7:2] = VREG: 3.840V + (val × 16mV)
-const uint8_t VREG_4208MV = 0x17;  // 4.208V = 3.840 + (23 × 0.016)
-const uint8_t VREG_4000MV = 0x0A;  // 4.000V = 3.840 + (10 × 0.016)
-bool float_mode_active = false;
+// Charger state as last seen by the charger task
+enum ChargeMode : uint8_t { CHARGE_BAT = 0, CHARGE_CHG = 1, CHARGE_FLT = 2 };
+volatile uint8_t charge_mode = CHARGE_BAT;
+volatile uint8_t battery_pct = 0;
+
+// BQ25896 INT line (open drain, pulses low on any status/fault change). Set
+// -DBQ_INT_PIN=<gpio> in platformio.ini if your board wires it to the S3;
+// without it the charger is polled, every second only while its state is
+// moving and every 5s once it has settled.
+#ifndef BQ_INT_PIN
+#define BQ_INT_PIN -1
+#endif
+const uint32_t CHARGER_POLL_FAST_MS = 1000;    // No INT line, state changed recently
+const uint32_t CHARGER_POLL_STABLE_MS = 5000;  // No INT line, state settled
+const uint32_t CHARGER_SETTLE_MS = 30000;      // Fast polling lasts this long after a change
+const uint32_t CHARGER_POLL_IDLE_MS = 60000;   // INT line - safety net only
+volatile uint32_t charger_irq_count = 0;
+
+// ============================================================================
+// TASKS - Rendering is pinned to one core, network/charger work to the other
+// ============================================================================
+
+const BaseType_t RENDER_CORE = 1;   // APP CPU - LVGL only
+const BaseType_t WORKER_CORE = 0;   // PRO CPU - shares the core with the WiFi stack
+TaskHandle_t render_task_handle = nullptr;
+TaskHandle_t net_task_handle = nullptr;
+TaskHandle_t charger_task_handle = nullptr;
+
+// Messages from worker tasks to the render task. Each producer has its own
+// SPSC queue, so nothing on the render path ever waits on the network.
+enum UiMsgType : uint8_t { MSG_BATTERY, MSG_NETWORK, MSG_SUN_TIMES, MSG_POWER };
+struct UiMsg {
+  UiMsgType type;
+  union {
+    struct { uint8_t pct; uint8_t mode; } battery;
+    struct { uint32_t ip; } network;
+    struct { bool on_battery; } power;
+  };
+};
+SpscQueue<UiMsg, 16> charger_to_ui;
+SpscQueue<UiMsg, 16> net_to_ui;
+
+// Render-side copies of worker state, only touched by the render task
+uint8_t ui_batt_pct = 0;
+uint8_t ui_charge_mode = CHARGE_BAT;
+uint32_t ui_ip = 0;
 
 // Fonts
 extern "C" {
@@ -104,35 +153,39 @@ extern "C" {
   extern const lv_font_t ds_digib_48;
 }
 
+#include "clock_service.h"
+#include "config_bus.h"
+
 // ============================================================================
 // CONFIG MANAGEMENT - Save/Load from NVS
 // ============================================================================
 
+#include "config_store.h"
+
+// What is in NVS right now, so unchanged saves never touch flash
+ConfigBlob stored_blob;
+uint32_t config_writes = 0;
+
 void save_config() {
+  ConfigBlob blob;
+  config_encode(config, blob);
+  if (memcmp(&blob, &stored_blob, sizeof(blob)) == 0) return;
   prefs.begin("clock", false);
-  prefs.putBool("show_sec", config.show_seconds);
-  prefs.putBool("show_date", config.show_date);
-  prefs.putUChar("color", config.color_scheme);
-  prefs.putBool("auto_br", config.auto_brightness);
-  prefs.putUChar("day_br", config.day_brightness);
-  prefs.putUChar("night_br", config.night_brightness);
-  prefs.putUChar("trans", config.transition_minutes);
-  prefs.putFloat("lat", config.latitude);
-  prefs.putFloat("lon", config.longitude);
-  prefs.putString("tz", config.timezone);
-  prefs.putString("ssid", config.wifi_ssid);
-  prefs.putString("pass", config.wifi_pass);
-  prefs.putBool("wthr_en", config.weather_enabled);
-  prefs.putString("wthr_key", config.weather_api_key);
+  prefs.putBytes("cfg", &blob, sizeof(blob));
   prefs.end();
+  stored_blob = blob;
+  config_writes++;
   Serial.println("💾 Config saved to NVS");
 }
 
-void load_config() {
-  prefs.begin("clock", true); // read-only
+// Pre-blob layout: one key per field. Read once, then replaced by the blob.
+bool load_legacy_config() {
+  if (!prefs.isKey("show_sec")) return false;
   config.show_seconds = prefs.getBool("show_sec", true);
   config.show_date = prefs.getBool("show_date", true);
   config.color_scheme = prefs.getUChar("color", 0);
+  config.clock_face = prefs.getUChar("face", FACE_FONT);
+  config.segment_skew = prefs.getChar("skew", 6);
   config.auto_brightness = prefs.getBool("auto_br", true);
   config.day_brightness = prefs.getUChar("day_br", 200);
   config.night_brightness = prefs.getUChar("night_br", 40);
@@ -144,136 +197,161 @@ void load_config() {
   prefs.getString("pass", config.wifi_pass, sizeof(config.wifi_pass));
   config.weather_enabled = prefs.getBool("wthr_en", false);
   prefs.getString("wthr_key", config.weather_api_key, sizeof(config.weather_api_key));
+  config_sanitize(config);
+  return true;
+}
+
+void load_config() {
+  uint8_t buf[sizeof(ConfigBlob)];
+  prefs.begin("clock", false);
+  size_t len = prefs.getBytes("cfg", buf, sizeof(buf));
+  ConfigDecodeResult result = len ? config_decode(buf, len, config) : CFG_DECODE_BAD;
+
+  if (result == CFG_DECODE_OK) {
+    memcpy(&stored_blob, buf, sizeof(stored_blob));
+    prefs.end();
+    Serial.println("📂 Config loaded from NVS");
+    return;
+  }
+
+  bool legacy = !len && load_legacy_config();
+  if (legacy) prefs.clear();  // Only the old per-field keys live here
   prefs.end();
-  Serial.println("📂 Config loaded from NVS");
+  if (legacy || result == CFG_DECODE_MIGRATED) {
+    Serial.println("📂 Config migrated to the current schema");
+  } else {
+    Serial.println(len ? "⚠️  Stored config is corrupt - using defaults" : "📂 No stored config - using defaults");
+    config = ClockConfig();
+  }
+  save_config();
 }
 
 // ============================================================================
 // BATTERY MANAGEMENT
 // ============================================================================
 
-uint8_t i2cRead(uint8_t dev, uint8_t reg) {
-  Wire.beginTransmission(dev);
-  Wire.write(reg);
-  if (Wire.endTransmission(false) != 0) return 0xFF;
-  if (Wire.requestFrom((int)dev, 1) != 1) return 0xFF;
-  return Wire.read();
-}
-
-bool i2cWriteMask(uint8_t dev, uint8_t reg, uint8_t mask, uint8_t value) {
-  uint8_t v = i2cRead(dev, reg);
-  if (v == 0xFF) return false;
-  v = (uint8_t)((v & ~mask) | (value & mask));
-  Wire.beginTransmission(dev);
-  Wire.write(reg);
-  Wire.write(v);
-  return Wire.endTransmission() == 0;
-}
+#include "bq25896.h"
+#include "charger_state.h"
 
 void configure_battery_charging() {
   Wire.begin();
-  if (i2cRead(BQ, 0x0B) == 0xFF) {
+  if (!bq_begin()) {
     Serial.println("⚠️  BQ2589x not detected");
     return;
   }
   Serial.println("🔋 Configuring charging...");
-  i2cWriteMask(BQ, 0x00, 0x80, 0x00);
-  i2cWriteMask(BQ, 0x00, 0x3F, 0x14);
-  i2cWriteMask(BQ, 0x01, 0x10, 0x10);
-  i2cWriteMask(BQ, 0x07, 0x30, 0x00);
-  i2cWriteMask(BQ, 0x04, 0x3F, 0x10);
-  i2cWriteMask(BQ, 0x06, 0xFC, (0x17 << 2));
-  i2cWriteMask(BQ, 0x0D, 0x7F, 0x0F);
-  i2cWriteMask(BQ, 0x02, 0x80, 0x80);
-  i2cWriteMask(BQ, 0x03, 0xF0, 0x50);  // CHG_CONFIG=1 to enable charging
-  i2cWriteMask(BQ, 0x03, 0x0F, 0x04);
+  bq_update_bits(0x00, 0x80, 0x00);
+  bq_update_bits(0x00, 0x3F, 0x14);
+  bq_update_bits(0x01, 0x10, 0x10);
+  bq_update_bits(0x07, 0x30, 0x00);
+  bq_update_bits(0x04, 0x3F, 0x10);
+  bq_update_bits(0x06, 0xFC, (VREG_4208MV << 2));
+  bq_update_bits(0x0D, 0x7F, 0x0F);
+  bq_update_bits(0x02, 0x80, 0x80);
+  bq_update_bits(0x03, 0xF0, 0x50);  // CHG_CONFIG=1 to enable charging
+  bq_update_bits(0x03, 0x0F, 0x04);
+  bq_flush();                        // One burst for REG00-REG0D
   delay(100);
   Serial.println("✓ Charging configured");
 }
 
-// CHRG_STAT in REG0B[4:3]: 00=Not charging, 01=Pre-charge, 10=Fast charging, 11=Charge done
-uint8_t get_charge_state() {
-  uint8_t stat = i2cRead(BQ, 0x0B);
-  if (stat == 0xFF) return 0;
-  return (stat >> 3) & 0x03;
+// Refresh the charger status and log what changed. Called when the INT line
+// fires, and on the poll. Returns true if VBUS, the charge state or a fault
+// moved.
+bool charger_service() {
+  uint8_t events = charger_refresh();
+  uint8_t status = bq_reg(BQ_REG_STATUS);
+  if (events & CHG_EVT_VBUS) {
+    Serial.printf("🔌 VBUS %s\n", (status >> 5) ? "present" : "removed");
+  }
+  if (events & CHG_EVT_STATE) {
+    const char* states[] = {"not charging", "pre-charge", "fast charge", "charge done"};
+    Serial.printf("🔋 Charger: %s\n", states[(status >> 3) & 0x03]);
+  }
+  if (events & CHG_EVT_FAULT) {
+    Serial.printf("⚠️  Charger fault REG0C=0x%02X\n", charger_last_fault);
+  }
+  return events != 0;
 }
 
-bool is_charging() {
-  uint8_t state = get_charge_state();
-  return (state == 1 || state == 2);  // Pre-charge or fast charging
-}
+// Read battery voltage and apply charger state, then hand the result to the UI.
+// Runs on the charger task, never on the render task.
+void battery_poll() {
+  battery_voltage = amoled.getBattVoltage() / 1000.0;
 
-bool is_charge_done() {
-  return get_charge_state() == 3;  // Charge termination done
-}
+  // Exponential moving average to smooth out ADC noise
+  // Alpha of 0.05 = slow response, very smooth. Takes ~60 readings to stabilize.
+  if (smoothed_voltage == 0.0) {
+    smoothed_voltage = battery_voltage;  // Initialize on first reading
+  } else {
+    smoothed_voltage = 0.05 * battery_voltage + 0.95 * smoothed_voltage;
+  }
 
-void set_charge_voltage(uint8_t vreg) {
-  i2cWriteMask(BQ, 0x06, 0xFC, (vreg << 2));
-}
+  int batt_pct = (int)((smoothed_voltage - 3.2) / 1.0 * 100.0);  // 3.2V=0%, 4.2V=100%
+  batt_pct = constrain(batt_pct, 0, 100);
 
-// Float voltage management - charge to 4.2V, then drop to 4.0V for longevity
-void manage_float_voltage() {
-  if (!float_mode_active && is_charge_done()) {
-    // Just finished charging - drop to float voltage
-    set_charge_voltage(VREG_4000MV);
-    float_mode_active = true;
-    Serial.println("🔋 Charge complete - dropping to 4.0V float");
-  }
-  else if (float_mode_active && battery_voltage < 3.9) {
-    // Battery has discharged below threshold - restore full charge voltage
-    set_charge_voltage(VREG_4208MV);
-    float_mode_active = false;
-    Serial.println("🔋 Battery low - restoring 4.2V charge");
+  // Manage float voltage for battery longevity
+  uint8_t events = manage_float_voltage(battery_voltage);
+  if (events & CHG_EVT_FLOAT_ON) Serial.println("🔋 Charge complete - dropping to 4.0V float");
+  if (events & CHG_EVT_FLOAT_OFF) Serial.println("🔋 Battery low - restoring 4.2V charge");
+
+  uint8_t mode = is_charging() ? CHARGE_CHG : (float_mode_active ? CHARGE_FLT : CHARGE_BAT);
+  if (mode != charge_mode || batt_pct != battery_pct) {
+    charge_mode = mode;
+    battery_pct = batt_pct;
+    UiMsg msg = {MSG_BATTERY};
+    msg.battery.pct = batt_pct;
+    msg.battery.mode = mode;
+    charger_to_ui.push(msg);
   }
 }
 
+// ============================================================================
+// POWER
+// ============================================================================
+
+#include "power_manager.h"
+
 // ============================================================================
 // SUNRISE/SUNSET
 // ============================================================================
 
-double julian_day(int y, int m, int d) {
-  int a = (14 - m) / 12;
-  int yy = y + 4800 - a;
-  int mm = m + 12 * a - 3;
-  return d + (153 * mm + 2) / 5 + 365 * yy + yy / 4 - yy / 100 + yy / 400 - 32045;
-}
-
-void calculate_sun_times(int year, int month, int day, float lat, float lon, int &sunrise_min, int &sunset_min) {
-  double jd = julian_day(year, month, day);
-  double n = jd - 2451545.0 + 0.0008;
-  double j_star = n - lon / 360.0;
-  double M = fmod(357.5291 + 0.98560028 * j_star, 360.0) * M_PI / 180.0;
-  double C = 1.9148 * sin(M) + 0.0200 * sin(2 * M) + 0.0003 * sin(3 * M);
-  double lambda = fmod(280.4665 + 0.98564736 * j_star + C, 360.0);
-  double j_transit = 2451545.0 + j_star + 0.0053 * sin(M) - 0.0069 * sin(2 * lambda * M_PI / 180.0);
-  double delta = asin(sin(lambda * M_PI / 180.0) * sin(23.44 * M_PI / 180.0));
-  double omega = acos((sin(-0.833 * M_PI / 180.0) - sin(lat * M_PI / 180.0) * sin(delta)) / 
-                      (cos(lat * M_PI / 180.0) * cos(delta)));
-  double j_rise = j_transit - omega * 180.0 / M_PI / 360.0;
-  double j_set = j_transit + omega * 180.0 / M_PI / 360.0;
-  sunrise_min = (int)((j_rise - floor(j_rise)) * 1440.0);
-  sunset_min = (int)((j_set - floor(j_set)) * 1440.0);
-  sunrise_min = (sunrise_min + 480) % 1440;
-  sunset_min = (sunset_min + 480) % 1440;
-}
+#include "sun_table.h"
 
+// Today's sunrise/sunset in local minutes, from the precomputed table
 void update_sun_times() {
-  struct tm ti;
-  if (!getLocalTime(&ti)) return;
-  calculate_sun_times(ti.tm_year + 1900, ti.tm_mon + 1, ti.tm_mday,
-                     config.latitude, config.longitude, sunrise_time, sunset_time);
-  Serial.printf("🌅 Sunrise: %02d:%02d, Sunset: %02d:%02d\n",
-                sunrise_time / 60, sunrise_time % 60,
-                sunset_time / 60, sunset_time % 60);
+  ClockSnapshot now;
+  clock_now(&now);
+  if (!now.valid) return;
+  sun_table_ensure(config.latitude, config.longitude);
+
+  time_t rise, set;
+  if (!sun_events(now.tm, rise, set)) {
+    sunrise_time = 6 * 60;   // Polar day/night - fall back to a fixed 6:00-18:00 day
+    sunset_time = 18 * 60;
+    Serial.println("🌅 No sunrise/sunset today - using 06:00/18:00");
+  } else {
+    struct tm t;
+    localtime_r(&rise, &t);
+    sunrise_time = t.tm_hour * 60 + t.tm_min;
+    localtime_r(&set, &t);
+    sunset_time = t.tm_hour * 60 + t.tm_min;
+    Serial.printf("🌅 Sunrise: %02d:%02d, Sunset: %02d:%02d\n",
+                  sunrise_time / 60, sunrise_time % 60,
+                  sunset_time / 60, sunset_time % 60);
+  }
+  UiMsg msg = {MSG_SUN_TIMES};  // Brightness schedule has moved
+  net_to_ui.push(msg);
 }
 
 uint8_t calculate_target_brightness() {
   if (brightness_mode != 0) return manual_levels[brightness_mode];
   if (!config.auto_brightness) return config.day_brightness;
   
-  struct tm ti;
-  if (!getLocalTime(&ti)) return config.day_brightness;
-  int now_min = ti.tm_hour * 60 + ti.tm_min;
+  ClockSnapshot now;
+  clock_now(&now);
+  if (!now.valid) return config.day_brightness;
+  int now_min = now.tm.tm_hour * 60 + now.tm.tm_min;
   
   if (now_min >= sunrise_time - config.transition_minutes && 
       now_min <= sunrise_time + config.transition_minutes) {
@@ -294,58 +372,62 @@ uint8_t calculate_target_brightness() {
   return is_day ? config.day_brightness : config.night_brightness;
 }
 
-// ============================================================================
-// WIFI
-// ============================================================================
-
-bool connect_wifi() {
-  Serial.printf("📡 Connecting to %s...\n", config.wifi_ssid);
-  WiFi.mode(WIFI_STA);
-  WiFi.begin(config.wifi_ssid, config.wifi_pass);
+// How long calculate_target_brightness() will keep returning the same value:
+// until the next minute inside a sunrise/sunset ramp, otherwise until the
+// ramp of the next sun event (from the table, so tomorrow's sunrise and a
+// DST change in between come out right) starts
+uint32_t brightness_next_change_ms() {
+  if (brightness_mode != 0 || !config.auto_brightness) return BRIGHTNESS_IDLE_MS;
+  ClockSnapshot now;
+  clock_now(&now);
+  if (!now.valid) return BRIGHTNESS_IDLE_MS;  // Sun times arrive with the first sync
   
-  int attempts = 0;
-  while (WiFi.status() != WL_CONNECTED && attempts < 20) {
-    delay(500);
-    Serial.print(".");
-    attempts++;
+  int now_min = now.tm.tm_hour * 60 + now.tm.tm_min;
+  uint32_t to_next_min = (60 - now.tm.tm_sec) * 1000;
+  int t = config.transition_minutes;
+  if ((now_min >= sunrise_time - t && now_min <= sunrise_time + t) ||
+      (now_min >= sunset_time - t && now_min <= sunset_time + t)) {
+    return to_next_min;
   }
-  Serial.println();
-  
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.printf("✓ Connected! IP: %s\n", WiFi.localIP().toString().c_str());
-    return true;
-  } else {
-    Serial.println("✗ WiFi failed");
-    return false;
+  time_t rise, set;
+  time_t event = sun_table_ready && sun_events(now.tm, rise, set) ? sun_next_transition(now.epoch) : 0;
+  if (event) {
+    time_t ramp = event - t * 60;
+    return ramp > now.epoch ? (uint32_t)(ramp - now.epoch) * 1000 : to_next_min;
+  }
+  // Polar day/night: the fixed 06:00/18:00 day of update_sun_times()
+  int edges[] = {sunrise_time - t, sunset_time - t, sunrise_time - t + 1440};
+  int next = 1440 + now_min;
+  for (int e : edges) {
+    if (e > now_min && e < next) next = e;
   }
+  return (next - now_min - 1) * 60000 + to_next_min;
 }
 
-void setup_time() {
-  // Set timezone FIRST
+// ============================================================================
+// WIFI
+// ============================================================================
+
+#include "wifi_manager.h"
+
+#include "time_sync.h"
+
+// Timezone rules only - applied at boot so local time is right the moment
+// the first SNTP reply lands. Sync itself runs from the net task.
+void setup_timezone() {
   setenv("TZ", config.timezone, 1);
   tzset();
-  
-  // Configure NTP - use local Starlink server first, then fallbacks
-  configTzTime(config.timezone, "192.168.100.1", "time.cloudflare.com", "time.google.com");
-  
-  Serial.print("⏰ Syncing time");
-  for (int i = 0; i < 120 && time(nullptr) < 1700000000; i++) {
-    delay(250);
-    if (i % 4 == 0) Serial.print(".");
-  }
-  Serial.println();
-  if (time(nullptr) >= 1700000000) {
-    Serial.println("✓ Time synced");
-    update_sun_times();
-  } else {
-    Serial.println("✗ Time sync failed");
-  }
 }
 
 // ============================================================================
 // UI
 // ============================================================================
 
+#include "digit_sprites.h"
+#include "seven_segment.h"
+#include "brightness_fade.h"
+#include "night_sleep.h"
+
 void style_label(lv_obj_t* obj, const lv_font_t* font, lv_color_t color, int16_t spacing = 2) {
   lv_obj_set_style_text_font(obj, font, 0);
   lv_obj_set_style_text_color(obj, color, 0);
@@ -355,6 +437,16 @@ void style_label(lv_obj_t* obj, const lv_font_t* font, lv_color_t color, int16_t
   lv_obj_set_style_pad_all(obj, 0, 0);
 }
 
+// Fill row_time with the slots of the configured face
+void create_time_row() {
+  active_face = config.clock_face;
+  if (active_face == FACE_SEGMENT) {
+    segment_row_create(row_time, SEGMENT_HEIGHT, config.segment_skew);
+  } else {
+    sprite_row_create(row_time);
+  }
+}
+
 void setup_ui() {
   lv_obj_t* scr = lv_scr_act();
   lv_obj_set_style_bg_color(scr, lv_color_black(), 0);
@@ -369,27 +461,20 @@ void setup_ui() {
   lv_obj_set_style_bg_opa(row_time, LV_OPA_TRANSP, 0);
   lv_obj_set_style_border_opa(row_time, LV_OPA_TRANSP, 0);
   lv_obj_set_style_pad_all(row_time, 0, 0);
-  lv_obj_set_style_pad_column(row_time, 3, 0);
-  lbl_hr = lv_label_create(row_time);
-  lbl_col1 = lv_label_create(row_time);
-  lbl_min = lv_label_create(row_time);
-  lbl_col2 = lv_label_create(row_time);
-  lbl_secA = lv_label_create(row_time);
+  lv_obj_set_style_pad_column(row_time, 2, 0);  // Same gap as the old label letter spacing
+  create_time_row();
   uint8_t c = config.color_scheme;
-  style_label(lbl_hr, &ds_digib_120, COLORS[c][0], 2);
-  style_label(lbl_col1, &ds_digib_120, COLORS[c][1], 2);
-  style_label(lbl_min, &ds_digib_120, COLORS[c][0], 2);
-  style_label(lbl_col2, &ds_digib_120, COLORS[c][1], 2);
-  style_label(lbl_secA, &ds_digib_120, COLORS[c][0], 2);
   date_label = lv_label_create(scr);
   lv_obj_set_width(date_label, LV_HOR_RES);
   lv_obj_set_style_text_align(date_label, LV_TEXT_ALIGN_CENTER, 0);
   style_label(date_label, &ds_digib_48, COLORS[c][1], 2);
+  lv_label_set_text(date_label, "");
   lv_obj_align_to(date_label, row_time, LV_ALIGN_OUT_BOTTOM_MID, 0, 10);
   status_label = lv_label_create(scr);
   lv_obj_set_width(status_label, LV_HOR_RES);
   lv_obj_set_style_text_align(status_label, LV_TEXT_ALIGN_CENTER, 0);
   style_label(status_label, &ds_digib_48, COLORS[c][1], 0);
+  lv_label_set_text(status_label, "");
   lv_obj_align_to(status_label, date_label, LV_ALIGN_OUT_BOTTOM_MID, 0, 4);
 }
 
@@ -397,18 +482,128 @@ void handle_touch(lv_event_t* e) {
   brightness_mode = (brightness_mode + 1) % 4;
   const char* modes[] = {"Auto", "Full", "Dim", "Medium"};
   Serial.printf("👆 Brightness: %s\n", modes[brightness_mode]);
-  target_brightness = calculate_target_brightness();
-}
-
-void update_display(lv_timer_t*) {
-  struct tm ti;
-  if (!getLocalTime(&ti)) {
-    lv_label_set_text(lbl_hr, "--");
-    lv_label_set_text(lbl_col1, ":");
-    lv_label_set_text(lbl_min, "--");
-    lv_label_set_text(lbl_col2, ":");
-    lv_label_set_text(lbl_secA, "-- A");
-    if (config.show_date) lv_label_set_text(date_label, "Syncing...");
+  fade_next_type = FADE_TOUCH;
+  lv_timer_ready(brightness_timer);
+  night_keep_awake();
+}
+
+// Push text to a label only if it differs from what the field last showed.
+// lv_label_set_text() invalidates the whole label area, so skipping unchanged
+// fields keeps LVGL from re-rasterizing 120px glyphs that did not move.
+bool set_field(DisplayField field, lv_obj_t* lbl, const char* text) {
+  if (strncmp(field_text[field], text, sizeof(field_text[field])) == 0) return false;
+  strlcpy(field_text[field], text, sizeof(field_text[field]));
+  lv_label_set_text(lbl, text);
+  inv_px_accum += (uint32_t)lv_obj_get_width(lbl) * lv_obj_get_height(lbl);
+  return true;
+}
+
+// Same as set_field() for the time row, which is drawn by the active face
+bool set_time_field(DisplayField field, const char* text) {
+  if (strncmp(field_text[field], text, sizeof(field_text[field])) == 0) return false;
+  strlcpy(field_text[field], text, sizeof(field_text[field]));
+  inv_px_accum += (active_face == FACE_SEGMENT) ? segment_field_set(field, text)
+                                                : sprite_field_set(field, text);
+  return true;
+}
+
+// Fold the invalidated area into a per-second rate for /api/status
+void roll_invalidation_window() {
+  uint32_t now = millis();
+  uint32_t elapsed = now - inv_px_window_start;
+  if (elapsed < 1000) return;
+  inv_px_per_sec = (uint32_t)((uint64_t)inv_px_accum * 1000 / elapsed);
+  inv_px_accum = 0;
+  inv_px_window_start = now;
+}
+
+// Without seconds on screen nothing changes between minute boundaries
+bool display_minute_ticks() {
+  return !config.show_seconds || ui_low_power;
+}
+
+// Measure how far past the second (or minute) boundary this tick fired, then
+// re-arm the timer so the next one lands TICK_LEAD_MS after the following one
+void align_display_tick(lv_timer_t* timer) {
+  static uint8_t ticks = 0;
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  int32_t period = display_minute_ticks() ? 60000 : 1000;
+  int32_t phase_ms = (int32_t)(((uint64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000) % period);
+  lv_timer_set_period(timer, period - phase_ms + TICK_LEAD_MS);
+  if (display_tick_forced) {
+    display_tick_forced = false;
+    return;
+  }
+
+  // Firing just before a boundary counts as early, not a whole period late
+  tick_phase_err_ms = (phase_ms >= period / 2 ? phase_ms - period : phase_ms) - TICK_LEAD_MS;
+  if (++ticks >= 60) {
+    ticks = 0;
+    tick_phase_worst_ms = 0;
+  }
+  tick_phase_worst_ms = max(tick_phase_worst_ms, (int32_t)abs(tick_phase_err_ms));
+}
+
+// RM67162 / RM690B0 partial display mode: only the rows and columns inside
+// the window are scanned, the rest of the panel stays dark. Both panels are
+// native portrait, so in landscape the screen x range runs along panel rows.
+// Passing nullptr returns to normal mode.
+void panel_set_window(const lv_area_t* a) {
+  if (!a) {
+    if (panel_window.x2 < panel_window.x1) return;
+    amoled.writeCommand(0x13, nullptr, 0);   // NORON
+    panel_window = {0, 0, -1, -1};
+    return;
+  }
+  if (memcmp(a, &panel_window, sizeof(*a)) == 0) return;
+  panel_window = *a;
+  bool landscape = LV_HOR_RES > LV_VER_RES;
+  lv_coord_t r1 = landscape ? a->x1 : a->y1, r2 = landscape ? a->x2 : a->y2;
+  lv_coord_t c1 = landscape ? a->y1 : a->x1, c2 = landscape ? a->y2 : a->x2;
+  uint8_t rows[] = {(uint8_t)(r1 >> 8), (uint8_t)r1, (uint8_t)(r2 >> 8), (uint8_t)r2};
+  uint8_t cols[] = {(uint8_t)(c1 >> 8), (uint8_t)c1, (uint8_t)(c2 >> 8), (uint8_t)c2};
+  amoled.writeCommand(0x30, rows, sizeof(rows));   // PTLAR
+  amoled.writeCommand(0x31, cols, sizeof(cols));   // PTLAC
+  amoled.writeCommand(0x12, nullptr, 0);           // PTLON
+}
+
+// Partial window around the time row's slots. It is kept symmetric about
+// the screen centre (the row is centred anyway), so it does not matter how
+// the rotation mirrors the panel axes.
+void low_power_window_sync() {
+  lv_obj_update_layout(row_time);
+  lv_coord_t mx = LV_HOR_RES / 2, my = LV_VER_RES / 2;
+  for (uint32_t i = 0; i < lv_obj_get_child_cnt(row_time); i++) {
+    lv_area_t c;
+    lv_obj_get_coords(lv_obj_get_child(row_time, i), &c);
+    mx = min(mx, (lv_coord_t)min(c.x1, (lv_coord_t)(LV_HOR_RES - 1 - c.x2)));
+    my = min(my, (lv_coord_t)min(c.y1, (lv_coord_t)(LV_VER_RES - 1 - c.y2)));
+  }
+  mx = max(mx, (lv_coord_t)0);
+  my = max(my, (lv_coord_t)0);
+  lv_area_t win = {mx, my, (lv_coord_t)(LV_HOR_RES - 1 - mx), (lv_coord_t)(LV_VER_RES - 1 - my)};
+  panel_set_window(&win);
+}
+
+void update_display(lv_timer_t* timer) {
+  PERF_SCOPE(PERF_DISPLAY);
+  align_display_tick(timer);
+  roll_invalidation_window();
+  if (active_face == FACE_SEGMENT) segment_color_sync();
+  else sprite_cache_sync();
+
+  ClockSnapshot now;
+  clock_now(&now);
+  const struct tm& ti = now.tm;
+  if (!now.valid) {
+    set_time_field(FIELD_HOUR, "--");
+    set_time_field(FIELD_MINUTE, "--");
+    set_time_field(FIELD_COLON, ":");
+    set_time_field(FIELD_SECONDS, "--");
+    set_time_field(FIELD_AMPM, " A");
+    if (config.show_date && !ui_low_power) set_field(FIELD_DATE, date_label, "Syncing...");
+    lv_timer_set_period(timer, 1000);  // Keep watching for the first sync, even on minute ticks
     return;
   }
   
@@ -423,64 +618,127 @@ void update_display(lv_timer_t*) {
   char sbuf[3]; strftime(sbuf, sizeof(sbuf), "%S", &ti);
   char apbuf[3]; strftime(apbuf, sizeof(apbuf), "%p", &ti);
   
-  lv_label_set_text(lbl_hr, hbuf);
-  lv_label_set_text(lbl_col1, ":");
-  lv_label_set_text(lbl_min, mbuf);
-  lv_label_set_text(lbl_col2, config.show_seconds ? ":" : "");
+  set_time_field(FIELD_HOUR, hbuf);
+  set_time_field(FIELD_MINUTE, mbuf);
+  if (!night.visible_ms) night.digits_pending = true;
+  bool show_seconds = config.show_seconds && !ui_low_power;
+  set_time_field(FIELD_COLON, show_seconds ? ":" : "");
   
-  if (config.show_seconds) {
-    char secA[6];
-    snprintf(secA, sizeof(secA), "%s %s", sbuf, apbuf);
-    lv_label_set_text(lbl_secA, secA);
+  if (show_seconds) {
+    char apsp[4];
+    snprintf(apsp, sizeof(apsp), " %s", apbuf);
+    set_time_field(FIELD_SECONDS, sbuf);
+    set_time_field(FIELD_AMPM, apsp);
   } else {
-    lv_label_set_text(lbl_secA, apbuf);
+    set_time_field(FIELD_SECONDS, "");
+    set_time_field(FIELD_AMPM, apbuf);
+  }
+  if (ui_low_power) {
+    low_power_window_sync();  // Date and status are outside the scanned window
+    return;
   }
   
   if (config.show_date) {
     char dbuf[40];
     strftime(dbuf, sizeof(dbuf), "%a, %b %d", &ti);
-    lv_label_set_text(date_label, dbuf);
+    set_field(FIELD_DATE, date_label, dbuf);
   }
   
-  battery_voltage = amoled.getBattVoltage() / 1000.0;
+  static const char* const MODE_NAMES[] = {"bat", "chg", "flt"};
+  char status[64];
+  snprintf(status, sizeof(status), "%s %d%% - %u.%u.%u.%u", MODE_NAMES[ui_charge_mode], ui_batt_pct,
+           ui_ip & 0xFF, (ui_ip >> 8) & 0xFF, (ui_ip >> 16) & 0xFF, ui_ip >> 24);
+  set_field(FIELD_STATUS, status_label, status);
+}
 
-  // Exponential moving average to smooth out ADC noise
-  // Alpha of 0.05 = slow response, very smooth. Takes ~60 readings to stabilize.
-  if (smoothed_voltage == 0.0) {
-    smoothed_voltage = battery_voltage;  // Initialize on first reading
-  } else {
-    smoothed_voltage = 0.05 * battery_voltage + 0.95 * smoothed_voltage;
-  }
+// Swap the time row to a new face or skew. The time field caches are cleared
+// so the next update_display() fills every slot of the new row.
+void rebuild_time_row() {
+  lv_obj_clean(row_time);
+  create_time_row();
+  for (int f = FIELD_HOUR; f <= FIELD_AMPM; f++) field_text[f][0] = '\0';
+  // The faces differ in height, so the labels below have to follow
+  lv_obj_align_to(date_label, row_time, LV_ALIGN_OUT_BOTTOM_MID, 0, 10);
+  lv_obj_align_to(status_label, date_label, LV_ALIGN_OUT_BOTTOM_MID, 0, 4);
+}
 
-  int batt_pct = (int)((smoothed_voltage - 3.2) / 1.0 * 100.0);  // 3.2V=0%, 4.2V=100%
-  batt_pct = constrain(batt_pct, 0, 100);
+// Config bus subscriber (render task): display fields, color and face
+void ui_apply_config(uint32_t changed) {
+  if (changed & CFG_FACE) rebuild_time_row();
+  if (changed & CFG_COLOR) {
+    // The time row re-syncs its own colors on the next tick
+    lv_obj_set_style_text_color(date_label, COLORS[config.color_scheme][1], 0);
+    lv_obj_set_style_text_color(status_label, COLORS[config.color_scheme][1], 0);
+  }
+  if ((changed & CFG_DATE) && !config.show_date) set_field(FIELD_DATE, date_label, "");
+  // Repaint now instead of at the next second boundary
+  display_tick_forced = true;
+  lv_timer_ready(display_timer);
+}
 
-  // Manage float voltage for battery longevity
-  manage_float_voltage();
+// Config bus subscriber (render task): new levels or curve take effect on
+// the ramp straight away
+void brightness_apply_config(uint32_t) {
+  fade_next_type = FADE_CONFIG;
+  lv_timer_ready(brightness_timer);
+}
 
-  char status[64];
-  if (is_charging()) {
-    snprintf(status, sizeof(status), "chg %d%% - %s", batt_pct, WiFi.localIP().toString().c_str());
-  } else if (float_mode_active) {
-    snprintf(status, sizeof(status), "flt %d%% - %s", batt_pct, WiFi.localIP().toString().c_str());
-  } else {
-    snprintf(status, sizeof(status), "bat %d%% - %s", batt_pct, WiFi.localIP().toString().c_str());
+// Runs only when the target can have changed or a fade is in progress, and
+// only talks to the panel when the level actually moves
+void update_brightness(lv_timer_t* timer) {
+  PERF_SCOPE(PERF_BRIGHTNESS);
+  brightness_wakeups++;
+  uint32_t now = millis();
+  uint8_t target = calculate_target_brightness();
+  if (target != target_brightness) {
+    fade_start(current_brightness, target, (FadeType)fade_next_type, now);
+    target_brightness = target;
+  }
+  fade_next_type = FADE_AUTO;
+  current_brightness = fade_level(now);
+  if (current_brightness != panel_brightness) {
+    amoled.setBrightness(current_brightness);
+    panel_brightness = current_brightness;
+    brightness_writes++;
   }
-  lv_label_set_text(status_label, status);
+  lv_timer_set_period(timer, fade_active(now) ? FADE_FRAME_MS : brightness_next_change_ms());
 }
 
-void update_brightness(lv_timer_t*) {
-  target_brightness = calculate_target_brightness();
-  if (current_brightness < target_brightness) current_brightness++;
-  else if (current_brightness > target_brightness) current_brightness--;
-  amoled.setBrightness(current_brightness);
+// Switched by the charger task's power state: on battery the face drops
+// seconds, date and status, and touch is polled less often. Only a detected
+// charger can put the board on battery.
+void low_power_set(bool on) {
+  if (on == ui_low_power) return;
+  ui_low_power = on;
+  lv_indev_t* indev = lv_indev_get_next(nullptr);
+  if (indev && indev->driver->read_timer) {
+    lv_timer_set_period(indev->driver->read_timer, on ? LOW_POWER_TOUCH_MS : LV_INDEV_DEF_READ_PERIOD);
+  }
+  if (!on) panel_set_window(nullptr);
+  Serial.printf("🌙 Low-power face %s\n", on ? "on" : "off");
+  display_tick_forced = true;
+  lv_timer_ready(display_timer);
 }
 
-void check_wifi(lv_timer_t*) {
-  if (WiFi.status() != WL_CONNECTED) {
-    Serial.println("📡 Reconnecting WiFi...");
-    connect_wifi();
-    if (WiFi.status() == WL_CONNECTED) setup_time();
+// Apply everything the workers posted since the last frame
+void drain_ui_messages() {
+  UiMsg msg;
+  while (charger_to_ui.pop(msg) || net_to_ui.pop(msg)) {
+    switch (msg.type) {
+      case MSG_BATTERY:
+        ui_batt_pct = msg.battery.pct;
+        ui_charge_mode = msg.battery.mode;
+        break;
+      case MSG_NETWORK:
+        ui_ip = msg.network.ip;
+        break;
+      case MSG_SUN_TIMES:
+        lv_timer_ready(brightness_timer);
+        break;
+      case MSG_POWER:
+        low_power_set(msg.power.on_battery);
+        break;
+    }
   }
 }
 
@@ -490,13 +748,169 @@ void check_wifi(lv_timer_t*) {
 
 #include "web_interface.h"
 
+// ============================================================================
+// WORKER TASKS
+// ============================================================================
+
+// Swap in configs submitted by the web server, save them and tell the
+// subscribers. Net task only - the one writer of `config` after boot.
+void config_take_submitted() {
+  ClockConfig next;
+  while (config_inbox.pop(next)) {
+    uint32_t changed = config_diff(config, next);
+    if (!changed) continue;
+    portENTER_CRITICAL(&config_mux);
+    config = next;
+    portEXIT_CRITICAL(&config_mux);
+    save_config();
+    config_publish(changed);
+  }
+}
+
+// Config bus subscriber (net task): TZ rules and sun times
+void time_apply_config(uint32_t changed) {
+  if (changed & CFG_TIMEZONE) {
+    setup_timezone();
+    clock_invalidate();
+  }
+  update_sun_times();
+}
+
+// Config bus subscriber (net task): reconnect only for new credentials
+void wifi_apply_config(uint32_t) {
+  wifi_manager_restart();
+}
+
+void post_network_state() {
+  static uint32_t last_ip = 0;
+  uint32_t ip = WiFi.status() == WL_CONNECTED ? (uint32_t)WiFi.localIP() : 0;
+  if (ip == last_ip) return;
+  UiMsg msg = {MSG_NETWORK};
+  msg.network.ip = ip;
+  if (net_to_ui.push(msg)) last_ip = ip;
+}
+
+const uint32_t NET_POLL_MS = 5;
+const uint32_t NET_POLL_BATTERY_MS = 50;   // Requests are served by AsyncTCP, not this loop
+
+// Web server, WiFi state machine, SNTP and the daily sun calculation. Runs
+// beside the render task, so nothing here can freeze the clock face.
+void net_task(void*) {
+  wifi_manager_begin();
+  bool web_started = false;
+  uint32_t seen_day = 0;
+
+  for (;;) {
+    uint32_t woke = micros();
+    bool wifi_up;
+    {
+      PERF_SCOPE(PERF_WIFI);
+      wifi_up = wifi_manager_poll();
+    }
+    if (wifi_up) {
+      time_sync_start();
+      if (!web_started) {
+        setup_web_server();
+        web_started = true;
+      }
+    }
+    if (web_started) handle_web_server();
+    config_take_submitted();
+    config_dispatch(CFG_OWNER_NET);
+    if (time_sync_poll()) {
+      night_sleep_learn();
+      update_sun_times();
+    }
+    post_network_state();
+
+    ClockSnapshot now;
+    clock_now(&now);  // Advances the rollover events even if no one else asked
+    if (clock_changed(CLOCK_DAY, seen_day)) update_sun_times();
+    power_busy(woke);
+    vTaskDelay(pdMS_TO_TICKS(power.on_battery ? NET_POLL_BATTERY_MS : NET_POLL_MS));
+  }
+}
+
+void IRAM_ATTR bq_int_isr() {
+  BaseType_t woken = pdFALSE;
+  charger_irq_count++;
+  vTaskNotifyGiveFromISR(charger_task_handle, &woken);
+  portYIELD_FROM_ISR(woken);
+}
+
+// I2C poll period for the charger status: with an INT line only a safety
+// net, without one fast for a while after each change, then backed off
+uint32_t charger_poll_ms(uint32_t since_change) {
+#if BQ_INT_PIN >= 0 || defined(CHARGER_SIM)
+  return CHARGER_POLL_IDLE_MS;
+#else
+  return since_change < CHARGER_SETTLE_MS ? CHARGER_POLL_FAST_MS : CHARGER_POLL_STABLE_MS;
+#endif
+}
+
+// Battery ADC once per second; BQ25896 I2C only when the INT line (or the
+// simulator) says something changed, or on the poll
+void charger_task(void*) {
+  uint32_t last_adc = 0, last_i2c = 0, last_change = 0;
+  bool first = true;
+
+  for (;;) {
+    uint32_t since_adc = millis() - last_adc;
+    uint32_t wait_ms = first ? 0 : 1000 - min(since_adc, (uint32_t)1000);
+    bool irq = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait_ms)) > 0;
+
+    uint32_t woke = micros();
+    uint32_t now = millis();
+    if (first || irq || now - last_i2c >= charger_poll_ms(now - last_change)) {
+      if (charger_service()) last_change = now;
+      if (power_update(bq.present, vbus_present(), is_charging())) {
+        UiMsg msg = {MSG_POWER};
+        msg.power.on_battery = bq.present && power.on_battery;  // No charger, no battery face
+        charger_to_ui.push(msg);
+      }
+      last_i2c = now;
+    }
+    bq_roll_stats();
+    power_roll();
+    if (first || irq || now - last_adc >= 1000) {
+      battery_poll();
+      last_adc = now;
+    }
+    first = false;
+    power_busy(woke);
+  }
+}
+
+// The only task that touches LVGL (and the display bus) after setup()
+const uint32_t RENDER_MAX_SLEEP_MS = 100;
+
+void render_task(void*) {
+  for (;;) {
+    uint32_t woke = micros();
+    drain_ui_messages();
+    config_dispatch(CFG_OWNER_RENDER);
+    uint32_t next_ms;
+    {
+      PERF_SCOPE(PERF_LV_TIMER);
+      next_ms = lv_timer_handler();
+    }
+    night_note_visible();
+    power_busy(woke);
+    // Sleep until the next LVGL deadline (the touch read timer caps it at ~30ms)
+    vTaskDelay(pdMS_TO_TICKS(constrain(next_ms, (uint32_t)1, RENDER_MAX_SLEEP_MS)));
+  }
+}
+
 // ============================================================================
 // SETUP
 // ============================================================================
 
 void setup() {
   Serial.begin(115200);
-  delay(500);
+  // The pause only lets a serial monitor catch the banner after a reset. A
+  // wake from night sleep goes straight on - it would count against wake_ms.
+  esp_sleep_wakeup_cause_t wake = esp_sleep_get_wakeup_cause();
+  if (wake != ESP_SLEEP_WAKEUP_TIMER && wake != ESP_SLEEP_WAKEUP_EXT0) delay(500);
   
   Serial.println("\n\n");
   Serial.println("╔════════════════════════════════════════╗");
@@ -505,30 +919,51 @@ void setup() {
   Serial.println("╚════════════════════════════════════════╝");
   Serial.println();
   
+  night_sleep_boot();  // Before anything reads the clock
+  
   // Load config from NVS
   load_config();
+  setup_timezone();
   
   if (!amoled.begin()) {
     Serial.println("❌ AMOLED init failed!");
     while(1) delay(1000);
   }
   amoled.setBrightness(config.day_brightness);
+  current_brightness = target_brightness = panel_brightness = config.day_brightness;
   
   configure_battery_charging();
+  power_begin();
   
   beginLvglHelper(amoled, true);
   setup_ui();
   
   lv_obj_add_event_cb(lv_scr_act(), handle_touch, LV_EVENT_CLICKED, nullptr);
   
-  if (connect_wifi()) {
-    setup_time();
-    setup_web_server(); // NEW! Start web server
-  }
+  display_timer = lv_timer_create(update_display, 1000, nullptr);  // Period is re-aligned on every tick
+  fade_init();
+  fade.target = current_brightness;  // Hold the boot level until the target first moves
+  brightness_timer = lv_timer_create(update_brightness, FADE_FRAME_MS, nullptr);
+  night_timer = lv_timer_create(night_check, NIGHT_CHECK_MS, nullptr);
+  
+  // Config changes from the web UI are applied live by whoever owns them
+  config_subscribe(CFG_OWNER_RENDER, CFG_SECONDS | CFG_DATE | CFG_COLOR | CFG_FACE, ui_apply_config, "display");
+  config_subscribe(CFG_OWNER_RENDER, CFG_BRIGHTNESS, brightness_apply_config, "brightness");
+  config_subscribe(CFG_OWNER_RENDER, CFG_SLEEP, night_apply_config, "night sleep");
+  config_subscribe(CFG_OWNER_NET, CFG_LOCATION | CFG_TIMEZONE, time_apply_config, "time");
+  config_subscribe(CFG_OWNER_NET, CFG_WIFI, wifi_apply_config, "wifi");
   
-  lv_timer_create(update_display, 1000, nullptr);
-  lv_timer_create(update_brightness, 100, nullptr);
-  lv_timer_create(check_wifi, 60000, nullptr);
+  // LVGL is single-threaded: from here on only render_task may call lv_*
+  xTaskCreatePinnedToCore(render_task, "render", 8192, nullptr, 3, &render_task_handle, RENDER_CORE);
+  xTaskCreatePinnedToCore(net_task, "net", 8192, nullptr, 2, &net_task_handle, WORKER_CORE);
+  xTaskCreatePinnedToCore(charger_task, "charger", 4096, nullptr, 1, &charger_task_handle, WORKER_CORE);
+#if BQ_INT_PIN >= 0
+  pinMode(BQ_INT_PIN, INPUT_PULLUP);
+  attachInterrupt(digitalPinToInterrupt(BQ_INT_PIN), bq_int_isr, FALLING);
+#endif
+#ifdef CHARGER_SIM
+  charger_sim_begin();
+#endif
   
   Serial.println("✓ Clock ready!");
   Serial.println("👆 Tap screen to cycle brightness");
@@ -540,16 +975,8 @@ void setup() {
 // LOOP
 // ============================================================================
 
+// All work runs in the tasks started from setup()
 void loop() {
-  lv_timer_handler();
-  handle_web_server(); // NEW! Handle web requests
-  delay(5);
-  
-  static int last_day = -1;
-  struct tm ti;
-  if (getLocalTime(&ti) && ti.tm_mday != last_day) {
-    last_day = ti.tm_mday;
-    update_sun_times();
-  }
+  vTaskDelete(nullptr);
 }
 
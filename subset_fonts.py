@@ -0,0 +1,102 @@
+# Pre-build step: regenerate the DS-Digital LVGL fonts from fonts.json so each
+# size only carries the glyphs the firmware actually draws.
+#
+# Wired in platformio.ini as `extra_scripts = pre:subset_fonts.py`. Can also be
+# run by hand from the project root: `python subset_fonts.py`.
+#
+# A font is only regenerated when the "Opts:" header of its .c file does not
+# match the manifest, so normal builds (and fresh checkouts, whose mtimes mean
+# nothing) never touch src/fonts. The generated files are committed; only
+# editing fonts.json needs lv_font_conv on the PATH (npm i -g lv_font_conv).
+# The script never installs it - a stale font without it fails the build.
+
+import io, json, os, re, shutil, subprocess, sys
+
+try:
+    Import("env")
+    PROJECT_DIR = env.subst("$PROJECT_DIR")
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.abspath(__file__))
+
+MANIFEST = os.path.join(PROJECT_DIR, "fonts.json")
+GLYPH_DSC_SIZE = 8  # sizeof(lv_font_fmt_txt_glyph_dsc_t) in LVGL 8
+
+
+def chars_to_range(chars):
+    """Collapse a character set into lv_font_conv --range syntax (0x30-0x3A,0x41)."""
+    cps = sorted(set(ord(c) for c in chars))
+    parts, start = [], None
+    for i, cp in enumerate(cps):
+        if start is None:
+            start = cp
+        if i + 1 < len(cps) and cps[i + 1] == cp + 1:
+            continue
+        parts.append("0x%02X" % start if start == cp else "0x%02X-0x%02X" % (start, cp))
+        start = None
+    return ",".join(parts)
+
+
+def conv_args(manifest, font):
+    rng = font.get("range") or chars_to_range(font["chars"])
+    out = "%s/%s.c" % (manifest["output_dir"], font["name"])
+    return ["--font", manifest["font"], "--size", str(font["size"]),
+            "--bpp", str(manifest.get("bpp", 4)), "--format", "lvgl", "--no-compress",
+            "--range", rng, "--output", out], out
+
+
+def font_flash_bytes(path):
+    """Estimate flash used by a generated font: glyph bitmaps + glyph descriptors."""
+    try:
+        src = io.open(path, "r", encoding="utf-8").read()
+    except FileNotFoundError:
+        return 0
+    m = re.search(r"glyph_bitmap\[\]\s*=\s*\{(.*?)\};", src, re.S)
+    bitmap = len(re.findall(r"0x[0-9a-fA-F]+", m.group(1))) if m else 0
+    glyphs = len(re.findall(r"\{\.bitmap_index", src))
+    return bitmap + glyphs * GLYPH_DSC_SIZE
+
+
+def current_opts(path):
+    try:
+        with io.open(path, "r", encoding="utf-8") as f:
+            for line in f:
+                if "Opts:" in line:
+                    return line.split("Opts:", 1)[1].strip()
+    except FileNotFoundError:
+        pass
+    return None
+
+
+def fail(msg):
+    sys.stderr.write("[fonts] error: %s\n" % msg)
+    sys.exit(1)
+
+
+def main():
+    manifest = json.load(io.open(MANIFEST, "r", encoding="utf-8"))
+    conv = shutil.which("lv_font_conv")
+    total_saved = 0
+
+    for font in manifest["fonts"]:
+        args, out = conv_args(manifest, font)
+        out_path = os.path.join(PROJECT_DIR, out)
+        if current_opts(out_path) == " ".join(args):
+            continue
+        if conv is None:
+            fail("%s does not match fonts.json and lv_font_conv is not on the PATH.\n"
+                 "        Install it (npm i -g lv_font_conv) or revert the manifest entry." % out)
+
+        before = font_flash_bytes(out_path)
+        result = subprocess.run([conv] + args, cwd=PROJECT_DIR)
+        if result.returncode != 0:
+            fail("lv_font_conv failed for %s" % font["name"])
+        after = font_flash_bytes(out_path)
+        total_saved += before - after
+        print("[fonts] %-13s %7d B -> %7d B  (saved %d B, %s)" %
+              (font["name"], before, after, before - after, font.get("used_by", "")))
+
+    if total_saved:
+        print("[fonts] total flash saved: %d B" % total_saved)
+
+
+main()
@@ -0,0 +1,128 @@
+// Charge state machine (charger_state.h) against the simulated BQ25896
+// register file. Run with: pio test -e native
+
+#include <stdint.h>
+#include <string.h>
+#include <unity.h>
+
+uint32_t millis() { return 0; }  // Only bq_roll_stats() asks
+
+#include "bq25896.h"
+#include "charger_state.h"
+
+// REG0B values: VBUS_STAT[7:5] CHRG_STAT[4:3] PG_STAT[2]
+const uint8_t ST_UNPLUGGED = 0x00;
+const uint8_t ST_PRECHARGE = 0x2C;
+const uint8_t ST_FAST = 0x34;
+const uint8_t ST_DONE = 0x3C;
+const uint8_t FAULT_BAT_OVP = 0x08;
+
+uint8_t sim_vreg() {
+  return sim_regs[0x06] >> 2;
+}
+
+void setUp() {
+  memset(sim_regs, 0, sizeof(sim_regs));
+  sim_regs[0x06] = VREG_4208MV << 2;
+  bq = Bq25896();
+  bq_begin();
+  float_mode_active = false;
+  charger_last_fault = 0;
+}
+
+void tearDown() {}
+
+void test_vbus_plug_and_unplug() {
+  charger_sim_set(ST_PRECHARGE, 0);
+  TEST_ASSERT_EQUAL_UINT8(CHG_EVT_VBUS | CHG_EVT_STATE, charger_refresh());
+  TEST_ASSERT_TRUE(vbus_present());
+  TEST_ASSERT_TRUE(is_charging());
+
+  charger_sim_set(ST_UNPLUGGED, 0);
+  TEST_ASSERT_EQUAL_UINT8(CHG_EVT_VBUS | CHG_EVT_STATE, charger_refresh());
+  TEST_ASSERT_FALSE(vbus_present());
+  TEST_ASSERT_FALSE(is_charging());
+}
+
+void test_no_event_without_change() {
+  charger_sim_set(ST_FAST, 0);
+  charger_refresh();
+  TEST_ASSERT_EQUAL_UINT8(0, charger_refresh());
+  TEST_ASSERT_EQUAL_UINT8(0, manage_float_voltage(4.1f));
+}
+
+void test_charge_state_change_keeps_vbus() {
+  charger_sim_set(ST_PRECHARGE, 0);
+  charger_refresh();
+  charger_sim_set(ST_FAST, 0);
+  TEST_ASSERT_EQUAL_UINT8(CHG_EVT_STATE, charger_refresh());
+  TEST_ASSERT_TRUE(is_charging());
+}
+
+void test_charge_done_steps_float_voltage_down() {
+  charger_sim_set(ST_FAST, 0);
+  charger_refresh();
+  TEST_ASSERT_EQUAL_UINT8(0, manage_float_voltage(4.15f));
+  TEST_ASSERT_EQUAL_UINT8(VREG_4208MV, sim_vreg());
+
+  charger_sim_set(ST_DONE, 0);
+  TEST_ASSERT_EQUAL_UINT8(CHG_EVT_STATE, charger_refresh());
+  TEST_ASSERT_TRUE(is_charge_done());
+  TEST_ASSERT_FALSE(is_charging());
+  TEST_ASSERT_EQUAL_UINT8(CHG_EVT_FLOAT_ON, manage_float_voltage(4.2f));
+  TEST_ASSERT_TRUE(float_mode_active);
+  TEST_ASSERT_EQUAL_UINT8(VREG_4000MV, sim_vreg());
+
+  // Already floating - no second write
+  uint32_t txn = bq.txn;
+  TEST_ASSERT_EQUAL_UINT8(0, manage_float_voltage(4.0f));
+  TEST_ASSERT_EQUAL_UINT32(txn, bq.txn);
+}
+
+void test_float_voltage_restored_when_battery_sags() {
+  charger_sim_set(ST_DONE, 0);
+  charger_refresh();
+  manage_float_voltage(4.2f);
+  charger_sim_set(ST_UNPLUGGED, 0);
+  charger_refresh();
+
+  TEST_ASSERT_EQUAL_UINT8(0, manage_float_voltage(3.95f));
+  TEST_ASSERT_EQUAL_UINT8(VREG_4000MV, sim_vreg());
+  TEST_ASSERT_EQUAL_UINT8(CHG_EVT_FLOAT_OFF, manage_float_voltage(3.85f));
+  TEST_ASSERT_FALSE(float_mode_active);
+  TEST_ASSERT_EQUAL_UINT8(VREG_4208MV, sim_vreg());
+}
+
+void test_fault_is_latched_and_cleared_on_read() {
+  charger_sim_set(ST_DONE, 0);
+  charger_refresh();
+  charger_sim_set(ST_DONE, FAULT_BAT_OVP);
+  TEST_ASSERT_EQUAL_UINT8(CHG_EVT_FAULT, charger_refresh());
+  TEST_ASSERT_EQUAL_UINT8(FAULT_BAT_OVP, charger_last_fault);
+  TEST_ASSERT_EQUAL_UINT8(0, sim_regs[0x0C]);
+
+  // Cleared in the chip; the last fault stays visible for /api/status
+  TEST_ASSERT_EQUAL_UINT8(0, charger_refresh());
+  TEST_ASSERT_EQUAL_UINT8(FAULT_BAT_OVP, charger_last_fault);
+}
+
+void test_no_chip_no_events() {
+  bq.present = false;
+  charger_sim_set(ST_PRECHARGE, FAULT_BAT_OVP);
+  uint32_t txn = bq.txn;
+  TEST_ASSERT_EQUAL_UINT8(0, charger_refresh());
+  TEST_ASSERT_EQUAL_UINT32(txn, bq.txn);
+  TEST_ASSERT_FALSE(vbus_present());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_vbus_plug_and_unplug);
+  RUN_TEST(test_no_event_without_change);
+  RUN_TEST(test_charge_state_change_keeps_vbus);
+  RUN_TEST(test_charge_done_steps_float_voltage_down);
+  RUN_TEST(test_float_voltage_restored_when_battery_sags);
+  RUN_TEST(test_fault_is_latched_and_cleared_on_read);
+  RUN_TEST(test_no_chip_no_events);
+  return UNITY_END();
+}
@@ -0,0 +1,276 @@
+// Versioned config blob (config_store.h): CRC, round trip, schema
+// migration and corruption. Run with: pio test -e native
+
+#include <stdint.h>
+#include <string.h>
+#include <unity.h>
+
+#include "config_store.h"
+
+void setUp() {}
+void tearDown() {}
+
+// A config with every field moved off its default
+ClockConfig custom_config() {
+  ClockConfig c;
+  c.show_seconds = false;
+  c.show_date = false;
+  c.color_scheme = 4;
+  c.clock_face = 1;
+  c.segment_skew = 9;
+  c.auto_brightness = false;
+  c.day_brightness = 180;
+  c.night_brightness = 12;
+  c.transition_minutes = 45;
+  c.fade_ms[0] = 100;
+  c.fade_ms[1] = 1200;
+  c.fade_ms[2] = 5000;
+  c.fade_ease[0] = 0;
+  c.fade_ease[1] = 2;
+  c.fade_ease[2] = 1;
+  c.sleep_mode = 2;
+  c.sleep_start = 22 * 60 + 30;
+  c.sleep_end = 7 * 60;
+  c.latitude = 51.5074f;
+  c.longitude = -0.1278f;
+  strcpy(c.timezone, "GMT0BST,M3.5.0/1,M10.5.0");
+  strcpy(c.wifi_ssid, "clocknet");
+  strcpy(c.wifi_pass, "hunter2hunter2");
+  c.weather_enabled = true;
+  strcpy(c.weather_api_key, "0123456789abcdef");
+  return c;
+}
+
+// Blob as an older firmware would have written it
+template <typename Payload>
+size_t old_blob(uint8_t version, const Payload& p, uint8_t* buf) {
+  ConfigBlobHeader h = {};
+  h.magic = CONFIG_MAGIC;
+  h.version = version;
+  h.size = sizeof(p);
+  h.crc = config_crc32((const uint8_t*)&p, sizeof(p));
+  memcpy(buf, &h, sizeof(h));
+  memcpy(buf + sizeof(h), &p, sizeof(p));
+  return sizeof(h) + sizeof(p);
+}
+
+void assert_v1_fields(const ClockConfig& want, const ClockConfig& got) {
+  TEST_ASSERT_EQUAL(want.show_seconds, got.show_seconds);
+  TEST_ASSERT_EQUAL(want.show_date, got.show_date);
+  TEST_ASSERT_EQUAL_UINT8(want.color_scheme, got.color_scheme);
+  TEST_ASSERT_EQUAL_UINT8(want.clock_face, got.clock_face);
+  TEST_ASSERT_EQUAL(want.segment_skew, got.segment_skew);
+  TEST_ASSERT_EQUAL(want.auto_brightness, got.auto_brightness);
+  TEST_ASSERT_EQUAL_UINT8(want.day_brightness, got.day_brightness);
+  TEST_ASSERT_EQUAL_UINT8(want.night_brightness, got.night_brightness);
+  TEST_ASSERT_EQUAL_UINT8(want.transition_minutes, got.transition_minutes);
+  TEST_ASSERT_EQUAL_FLOAT(want.latitude, got.latitude);
+  TEST_ASSERT_EQUAL_FLOAT(want.longitude, got.longitude);
+  TEST_ASSERT_EQUAL_STRING(want.timezone, got.timezone);
+  TEST_ASSERT_EQUAL_STRING(want.wifi_ssid, got.wifi_ssid);
+  TEST_ASSERT_EQUAL_STRING(want.wifi_pass, got.wifi_pass);
+  TEST_ASSERT_EQUAL(want.weather_enabled, got.weather_enabled);
+  TEST_ASSERT_EQUAL_STRING(want.weather_api_key, got.weather_api_key);
+}
+
+void assert_v2_fields(const ClockConfig& want, const ClockConfig& got) {
+  assert_v1_fields(want, got);
+  TEST_ASSERT_EQUAL_MEMORY(want.fade_ms, got.fade_ms, sizeof(want.fade_ms));
+  TEST_ASSERT_EQUAL_MEMORY(want.fade_ease, got.fade_ease, sizeof(want.fade_ease));
+}
+
+void assert_v3_fields(const ClockConfig& want, const ClockConfig& got) {
+  assert_v2_fields(want, got);
+  TEST_ASSERT_EQUAL_UINT8(want.sleep_mode, got.sleep_mode);
+  TEST_ASSERT_EQUAL_UINT16(want.sleep_start, got.sleep_start);
+  TEST_ASSERT_EQUAL_UINT16(want.sleep_end, got.sleep_end);
+}
+
+void test_crc32_check_value() {
+  TEST_ASSERT_EQUAL_HEX32(0xCBF43926, config_crc32((const uint8_t*)"123456789", 9));
+  TEST_ASSERT_EQUAL_HEX32(0x00000000, config_crc32(nullptr, 0));
+}
+
+void test_round_trip() {
+  ClockConfig in = custom_config();
+  ConfigBlob blob;
+  config_encode(in, blob);
+  TEST_ASSERT_EQUAL_UINT16(CONFIG_MAGIC, blob.header.magic);
+  TEST_ASSERT_EQUAL_UINT8(CONFIG_SCHEMA_VERSION, blob.header.version);
+  TEST_ASSERT_EQUAL_UINT16(sizeof(ConfigPayloadV3), blob.header.size);
+
+  ClockConfig out;
+  TEST_ASSERT_EQUAL(CFG_DECODE_OK, config_decode((const uint8_t*)&blob, sizeof(blob), out));
+  assert_v3_fields(in, out);
+}
+
+// save_config() skips the flash write when the blob is unchanged
+void test_encode_is_deterministic() {
+  ClockConfig a = custom_config(), b = custom_config();
+  memset(a.wifi_pass, 'x', sizeof(a.wifi_pass));  // Garbage after the terminator
+  strcpy(a.wifi_pass, "hunter2hunter2");
+  ConfigBlob ea, eb;
+  config_encode(a, ea);
+  config_encode(b, eb);
+  TEST_ASSERT_EQUAL_MEMORY(&eb, &ea, sizeof(ea));
+}
+
+void test_migrate_v1_fills_defaults() {
+  ClockConfig in = custom_config();
+  ConfigPayloadV1 p = {};
+  config_to_v1(in, p);
+  uint8_t buf[sizeof(ConfigBlob)];
+  size_t len = old_blob(1, p, buf);
+
+  ClockConfig out = custom_config(), defaults;
+  TEST_ASSERT_EQUAL(CFG_DECODE_MIGRATED, config_decode(buf, len, out));
+  assert_v1_fields(in, out);
+  TEST_ASSERT_EQUAL_MEMORY(defaults.fade_ms, out.fade_ms, sizeof(out.fade_ms));
+  TEST_ASSERT_EQUAL_MEMORY(defaults.fade_ease, out.fade_ease, sizeof(out.fade_ease));
+  TEST_ASSERT_EQUAL_UINT8(defaults.sleep_mode, out.sleep_mode);
+  TEST_ASSERT_EQUAL_UINT16(defaults.sleep_start, out.sleep_start);
+  TEST_ASSERT_EQUAL_UINT16(defaults.sleep_end, out.sleep_end);
+}
+
+void test_migrate_v2_fills_defaults() {
+  ClockConfig in = custom_config();
+  ConfigPayloadV2 p = {};
+  config_to_v1(in, p.v1);
+  memcpy(p.fade_ms, in.fade_ms, sizeof(p.fade_ms));
+  memcpy(p.fade_ease, in.fade_ease, sizeof(p.fade_ease));
+  uint8_t buf[sizeof(ConfigBlob)];
+  size_t len = old_blob(2, p, buf);
+
+  ClockConfig out = custom_config(), defaults;
+  TEST_ASSERT_EQUAL(CFG_DECODE_MIGRATED, config_decode(buf, len, out));
+  assert_v2_fields(in, out);
+  TEST_ASSERT_EQUAL_UINT8(defaults.sleep_mode, out.sleep_mode);
+  TEST_ASSERT_EQUAL_UINT16(defaults.sleep_start, out.sleep_start);
+  TEST_ASSERT_EQUAL_UINT16(defaults.sleep_end, out.sleep_end);
+}
+
+// A migrated config re-encodes as the current schema and decodes cleanly
+void test_migrated_config_saves_as_current() {
+  ConfigPayloadV1 p = {};
+  config_to_v1(custom_config(), p);
+  uint8_t buf[sizeof(ConfigBlob)];
+  ClockConfig migrated;
+  TEST_ASSERT_EQUAL(CFG_DECODE_MIGRATED, config_decode(buf, old_blob(1, p, buf), migrated));
+
+  ConfigBlob blob;
+  config_encode(migrated, blob);
+  ClockConfig out;
+  TEST_ASSERT_EQUAL(CFG_DECODE_OK, config_decode((const uint8_t*)&blob, sizeof(blob), out));
+  assert_v3_fields(migrated, out);
+}
+
+void test_corruption_is_rejected() {
+  ConfigBlob blob;
+  config_encode(custom_config(), blob);
+  uint8_t* bytes = (uint8_t*)&blob;
+  ClockConfig keep = custom_config();
+
+  // One flipped bit, at every 7th payload byte
+  for (size_t i = sizeof(ConfigBlobHeader); i < sizeof(blob); i += 7) {
+    bytes[i] ^= 0x10;
+    ClockConfig out = keep;
+    TEST_ASSERT_EQUAL(CFG_DECODE_BAD, config_decode(bytes, sizeof(blob), out));
+    assert_v3_fields(keep, out);  // Left untouched
+    bytes[i] ^= 0x10;
+  }
+
+  ClockConfig out;
+  blob.header.crc ^= 1;
+  TEST_ASSERT_EQUAL(CFG_DECODE_BAD, config_decode(bytes, sizeof(blob), out));
+  blob.header.crc ^= 1;
+  TEST_ASSERT_EQUAL(CFG_DECODE_OK, config_decode(bytes, sizeof(blob), out));
+}
+
+void test_bad_header_is_rejected() {
+  ConfigBlob blob;
+  ClockConfig out;
+  const uint8_t* bytes = (const uint8_t*)&blob;
+
+  config_encode(custom_config(), blob);
+  blob.header.magic ^= 0x0100;
+  TEST_ASSERT_EQUAL(CFG_DECODE_BAD, config_decode(bytes, sizeof(blob), out));
+
+  config_encode(custom_config(), blob);
+  blob.header.version = CONFIG_SCHEMA_VERSION + 1;  // From newer firmware
+  TEST_ASSERT_EQUAL(CFG_DECODE_BAD, config_decode(bytes, sizeof(blob), out));
+
+  config_encode(custom_config(), blob);
+  TEST_ASSERT_EQUAL(CFG_DECODE_BAD, config_decode(bytes, sizeof(blob) - 1, out));  // Truncated read
+  TEST_ASSERT_EQUAL(CFG_DECODE_BAD, config_decode(bytes, sizeof(ConfigBlobHeader) - 1, out));
+  TEST_ASSERT_EQUAL(CFG_DECODE_BAD, config_decode(bytes, 0, out));
+
+  // Valid CRC over a payload of the wrong size for its version
+  config_encode(custom_config(), blob);
+  blob.header.version = 2;
+  TEST_ASSERT_EQUAL(CFG_DECODE_BAD, config_decode(bytes, sizeof(blob), out));
+}
+
+// A payload string that fills its field has no terminator
+void test_unterminated_strings_are_bounded() {
+  ConfigPayloadV3 p = {};
+  config_to_v1(custom_config(), p.v2.v1);
+  memset(p.v2.v1.timezone, 'A', sizeof(p.v2.v1.timezone));
+  memset(p.v2.v1.wifi_ssid, 'B', sizeof(p.v2.v1.wifi_ssid));
+  uint8_t buf[sizeof(ConfigBlob)];
+  size_t len = old_blob(3, p, buf);
+
+  ClockConfig out;
+  TEST_ASSERT_EQUAL(CFG_DECODE_OK, config_decode(buf, len, out));
+  TEST_ASSERT_EQUAL(sizeof(out.timezone) - 1, strlen(out.timezone));
+  TEST_ASSERT_EQUAL(sizeof(out.wifi_ssid) - 1, strlen(out.wifi_ssid));
+  TEST_ASSERT_EQUAL_STRING("hunter2hunter2", out.wifi_pass);  // Neighbour intact
+}
+
+// Fields that index COLORS[] or size the digit row are clamped on load
+void test_out_of_range_fields_are_clamped() {
+  ClockConfig in = custom_config();
+  in.color_scheme = 200;
+  in.clock_face = 7;
+  in.segment_skew = 127;
+  ConfigBlob blob;
+  config_encode(in, blob);  // Valid CRC over the bad values
+  ClockConfig out;
+  TEST_ASSERT_EQUAL(CFG_DECODE_OK, config_decode((const uint8_t*)&blob, sizeof(blob), out));
+  TEST_ASSERT_EQUAL_UINT8(COLOR_SCHEME_COUNT - 1, out.color_scheme);
+  TEST_ASSERT_EQUAL_UINT8(CLOCK_FACE_COUNT - 1, out.clock_face);
+  TEST_ASSERT_EQUAL(SEGMENT_SKEW_MAX, out.segment_skew);
+  TEST_ASSERT_EQUAL_STRING(in.timezone, out.timezone);  // The rest is kept
+
+  // Migrated blobs too
+  in.segment_skew = -128;
+  ConfigPayloadV1 p = {};
+  config_to_v1(in, p);
+  uint8_t buf[sizeof(ConfigBlob)];
+  TEST_ASSERT_EQUAL(CFG_DECODE_MIGRATED, config_decode(buf, old_blob(1, p, buf), out));
+  TEST_ASSERT_EQUAL_UINT8(COLOR_SCHEME_COUNT - 1, out.color_scheme);
+  TEST_ASSERT_EQUAL_UINT8(CLOCK_FACE_COUNT - 1, out.clock_face);
+  TEST_ASSERT_EQUAL(0, out.segment_skew);
+
+  // In-range values are left alone
+  ClockConfig edge = custom_config();
+  edge.color_scheme = COLOR_SCHEME_COUNT - 1;
+  edge.segment_skew = 0;
+  config_encode(edge, blob);
+  TEST_ASSERT_EQUAL(CFG_DECODE_OK, config_decode((const uint8_t*)&blob, sizeof(blob), out));
+  assert_v3_fields(edge, out);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_crc32_check_value);
+  RUN_TEST(test_round_trip);
+  RUN_TEST(test_encode_is_deterministic);
+  RUN_TEST(test_migrate_v1_fills_defaults);
+  RUN_TEST(test_migrate_v2_fills_defaults);
+  RUN_TEST(test_migrated_config_saves_as_current);
+  RUN_TEST(test_corruption_is_rejected);
+  RUN_TEST(test_bad_header_is_rejected);
+  RUN_TEST(test_unterminated_strings_are_bounded);
+  RUN_TEST(test_out_of_range_fields_are_clamped);
+  return UNITY_END();
+}
@@ -0,0 +1,190 @@
+# Host-side load test for the clock's web server: many concurrent clients
+# against the page and the JSON endpoints, with live dashboards held open on
+# /api/events, reporting p50/p99/max latency per endpoint.
+#
+# Run from any machine on the clock's network (Python 3.7+, no packages):
+#   python tools/web_load.py clock.local
+#   python tools/web_load.py 192.168.1.50 --clients 16 --duration 60 --sse 3
+#
+# Every request opens its own connection, as the async server closes after
+# each response. --post also POSTs the current config back unchanged: it is
+# parsed and diffed like any save, but an unchanged config is never queued
+# for the net task, so nothing is written to flash.
+#
+# The requests are served on the AsyncTCP task, so they should not show up
+# in the render loop. To check, /api/perf is read before and after the run
+# and the render probes' p99/max are printed side by side. Its window is one
+# minute, so keep --duration at 60s or more and let the clock idle for a
+# minute before starting.
+
+import argparse, asyncio, json, time
+
+ENDPOINTS = ["/", "/api/status", "/api/config"]
+RENDER_PROBES = ["lv_timer_handler", "update_display", "update_brightness"]
+
+
+class Stats:
+    def __init__(self):
+        self.latency = {}   # path -> [seconds]
+        self.status = {}    # (path, code) -> count
+        self.errors = {}    # path -> count
+        self.sse_events = 0
+        self.sse_gaps = []  # Seconds between events on one stream
+
+    def add(self, path, code, seconds):
+        self.latency.setdefault(path, []).append(seconds)
+        self.status[(path, code)] = self.status.get((path, code), 0) + 1
+
+    def error(self, path):
+        self.errors[path] = self.errors.get(path, 0) + 1
+
+
+def percentile(sorted_values, p):
+    if not sorted_values:
+        return 0.0
+    i = min(len(sorted_values) - 1, int(round(p / 100.0 * (len(sorted_values) - 1))))
+    return sorted_values[i]
+
+
+async def request(host, port, method, path, body=None, timeout=10.0):
+    """One HTTP/1.1 request on a fresh connection. Returns (status, body)."""
+    reader, writer = await asyncio.wait_for(asyncio.open_connection(host, port), timeout)
+    try:
+        head = "%s %s HTTP/1.1\r\nHost: %s\r\nAccept-Encoding: gzip\r\nConnection: close\r\n" % (method, path, host)
+        if body is not None:
+            head += "Content-Type: application/json\r\nContent-Length: %d\r\n" % len(body)
+        writer.write(head.encode() + b"\r\n" + (body or b""))
+        await writer.drain()
+        raw = await asyncio.wait_for(reader.read(), timeout)  # Server closes when done
+    finally:
+        writer.close()
+    status_line, _, rest = raw.partition(b"\r\n")
+    parts = status_line.split()
+    if len(parts) < 2 or not parts[1].isdigit():
+        raise IOError("bad status line %r" % status_line[:40])
+    headers, _, payload = rest.partition(b"\r\n\r\n")
+    if b"transfer-encoding: chunked" in headers.lower():
+        payload = dechunk(payload)
+    return int(parts[1]), payload
+
+
+def dechunk(data):
+    out = b""
+    while data:
+        size_line, _, data = data.partition(b"\r\n")
+        size = int(size_line.split(b";")[0] or b"0", 16)
+        if size == 0:
+            break
+        out += data[:size]
+        data = data[size + 2:]
+    return out
+
+
+async def client(host, port, paths, config_body, deadline, stats):
+    i = 0
+    while time.monotonic() < deadline:
+        path = paths[i % len(paths)]
+        i += 1
+        method, body = ("POST", config_body) if path == "POST /api/config" else ("GET", None)
+        url = path.split(" ")[-1]
+        start = time.monotonic()
+        try:
+            code, _ = await request(host, port, method, url, body)
+            stats.add(path, code, time.monotonic() - start)
+        except (OSError, IOError, asyncio.TimeoutError, ValueError):
+            stats.error(path)
+            await asyncio.sleep(0.2)  # Refused or reset - do not spin
+
+
+async def dashboard(host, port, deadline, stats):
+    """Hold /api/events open like the web page does and count the pushes."""
+    try:
+        reader, writer = await asyncio.wait_for(asyncio.open_connection(host, port), 10)
+    except (OSError, asyncio.TimeoutError):
+        stats.error("/api/events")
+        return
+    writer.write(("GET /api/events HTTP/1.1\r\nHost: %s\r\nAccept: text/event-stream\r\n\r\n" % host).encode())
+    last = None
+    try:
+        while time.monotonic() < deadline:
+            line = await asyncio.wait_for(reader.readline(), max(0.1, deadline - time.monotonic()))
+            if not line:
+                stats.error("/api/events")  # Closed on us (over SSE_MAX_CLIENTS?)
+                break
+            if line.startswith(b"data:"):
+                now = time.monotonic()
+                if last is not None:
+                    stats.sse_gaps.append(now - last)
+                last = now
+                stats.sse_events += 1
+    except asyncio.TimeoutError:
+        pass
+    finally:
+        writer.close()
+
+
+async def fetch_json(host, port, path):
+    try:
+        code, body = await request(host, port, "GET", path)
+        return json.loads(body) if code == 200 else None
+    except (OSError, IOError, asyncio.TimeoutError, ValueError):
+        return None
+
+
+def print_render(before, after):
+    if not before or not after:
+        print("\n/api/perf not available (built with -DPERF_PROBES=0?)")
+        return
+    print("\nRender loop (/api/perf, last minute)     idle p99/max        under load p99/max")
+    for name in RENDER_PROBES:
+        b, a = before["probes"].get(name), after["probes"].get(name)
+        if b and a:
+            print("  %-20s %10d / %-8d us %10d / %-8d us" % (name, b["p99_us"], b["max_us"], a["p99_us"], a["max_us"]))
+
+
+async def main():
+    ap = argparse.ArgumentParser(description="Load test for the clock's web server")
+    ap.add_argument("host")
+    ap.add_argument("--port", type=int, default=80)
+    ap.add_argument("--clients", type=int, default=16, help="concurrent request loops")
+    ap.add_argument("--duration", type=float, default=60, help="seconds")
+    ap.add_argument("--sse", type=int, default=2, help="dashboards on /api/events (server allows 4)")
+    ap.add_argument("--post", action="store_true", help="also POST /api/config (unchanged)")
+    args = ap.parse_args()
+
+    paths = list(ENDPOINTS)
+    config_body = None
+    if args.post:
+        config = await fetch_json(args.host, args.port, "/api/config")
+        if config is None:
+            raise SystemExit("GET /api/config failed - is %s reachable?" % args.host)
+        config_body = json.dumps(config).encode()
+        paths.append("POST /api/config")
+
+    before = await fetch_json(args.host, args.port, "/api/perf")
+    stats = Stats()
+    deadline = time.monotonic() + args.duration
+    print("%d clients + %d dashboards against %s for %ds..." % (args.clients, args.sse, args.host, args.duration))
+    tasks = [client(args.host, args.port, paths[i % len(paths):] + paths[:i % len(paths)], config_body, deadline, stats)
+             for i in range(args.clients)]
+    tasks += [dashboard(args.host, args.port, deadline, stats) for _ in range(args.sse)]
+    await asyncio.gather(*tasks)
+    after = await fetch_json(args.host, args.port, "/api/perf")
+
+    print("\n%-18s %7s %8s %8s %8s %6s  %s" % ("endpoint", "n", "p50 ms", "p99 ms", "max ms", "err", "status"))
+    for path in paths:
+        lat = sorted(stats.latency.get(path, []))
+        codes = ", ".join("%d x%d" % (c, n) for (p, c), n in sorted(stats.status.items()) if p == path)
+        print("%-18s %7d %8.1f %8.1f %8.1f %6d  %s" % (path, len(lat), percentile(lat, 50) * 1000,
+              percentile(lat, 99) * 1000, (lat[-1] if lat else 0) * 1000, stats.errors.get(path, 0), codes))
+    total = sum(len(v) for v in stats.latency.values())
+    print("%.1f requests/s" % (total / args.duration))
+    if args.sse:
+        gaps = sorted(stats.sse_gaps)
+        print("/api/events: %d events, gap p50 %.2fs max %.2fs, %d dropped streams" % (
+            stats.sse_events, percentile(gaps, 50), gaps[-1] if gaps else 0, stats.errors.get("/api/events", 0)))
+    print_render(before, after)
+
+
+if __name__ == "__main__":
+    asyncio.run(main())